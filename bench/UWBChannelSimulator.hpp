@@ -0,0 +1,411 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UWBCHANNELSIMULATOR_HPP_
+#define UWBCHANNELSIMULATOR_HPP_
+
+// Eigen
+#include <Eigen/Geometry>
+
+// std
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+// romea
+#include "romea_core_rtls/coordination/RTLSRangeAggregator.hpp"
+#include "romea_core_rtls/coordination/RTLSSimpleCoordinatorScheduler.hpp"
+#include "romea_core_rtls/coordination/RTLSVirtualClock.hpp"
+#include "romea_core_rtls/trilateration/RTLSPosition2DEstimator.hpp"
+
+struct UWBChannelParameters
+{
+  // exchange latency grows with range because of retries and lower data rates
+  double exchangeBaseLatency = 0.002;
+  double exchangeLatencyPerMeter = 0.00002;
+  double exchangeLatencyJitter = 0.0005;
+
+  // success probability decreases quadratically down to zero at maximal range
+  double maximalRange = 80.0;
+  double successProbability = 0.95;
+
+  // concurrent exchanges whose transceivers are closer than this distance collide,
+  // zero means that concurrent exchanges use separate channels
+  double interferenceDistance = 30.0;
+
+  double rangeStd = 0.05;
+  double nlosProbability = 0.1;
+  double nlosMeanBias = 0.5;
+
+  std::vector<size_t> deadResponders;
+
+  // (initiator, responder) links structurally blocked, by robot body for instance
+  std::vector<std::pair<size_t, size_t>> blockedLinks;
+
+  // (initiator, responder) links measuring noisier ranges, through foliage for instance
+  std::vector<std::pair<size_t, size_t>> noisyLinks;
+  double noisyLinkRangeStd = 0.5;
+};
+
+// Discrete event stand-in for UWB transceivers layer: a robot drives on a circle
+// among anchors (responders) and ranging requests of a scheduler are answered
+// according to channel model, everything being timed by a virtual clock
+class UWBChannelSimulator
+{
+public:
+  using Scheduler = romea::core::RTLSSimpleCoordinatorScheduler;
+  using RobotPositionCallback = std::function<void (const Eigen::Vector3d & /*position*/)>;
+
+  UWBChannelSimulator(
+    const UWBChannelParameters & parameters,
+    const romea::core::VectorOfEigenVector3d & respondersPositions,
+    const romea::core::VectorOfEigenVector3d & initiatorsPositions,
+    std::shared_ptr<romea::core::RTLSVirtualClock> clock)
+  : parameters_(parameters),
+    respondersPositions_(respondersPositions),
+    initiatorsPositions_(initiatorsPositions),
+    clock_(clock),
+    startStamp_(clock->now()),
+    generator_(0),
+    scheduler_(nullptr),
+    robotPositionTicker_(nullptr),
+    robotPositionCallback_(),
+    exchanges_(),
+    aggregator_(
+      initiatorsPositions.size(), respondersPositions.size(),
+      romea::core::durationFromMilliSecond(500), romea::core::durationFromMilliSecond(200), 3,
+      std::bind(&UWBChannelSimulator::fix_, this, std::placeholders::_1)),
+    estimator_(respondersPositions),
+    isRangesWeightingEnabled_(false),
+    rangesWeights_(),
+    numberOfRequests_(0),
+    numberOfRanges_(0),
+    numberOfCollisions_(0),
+    exchangesLatencies_(),
+    fixesStamps_(),
+    fixesErrors_()
+  {
+  }
+
+  ~UWBChannelSimulator()
+  {
+    if (robotPositionTicker_) {
+      robotPositionTicker_->stop();
+    }
+  }
+
+  void setScheduler(Scheduler * scheduler)
+  {
+    scheduler_ = scheduler;
+  }
+
+  Scheduler::RangingRequestCallback getRangingRequestCallback()
+  {
+    return std::bind(
+      &UWBChannelSimulator::request_, this,
+      std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
+  }
+
+  // robot position is given periodically, as a localisation filter would do
+  void setRobotPositionCallback(
+    RobotPositionCallback robotPositionCallback,
+    const romea::core::Duration & period)
+  {
+    robotPositionCallback_ = robotPositionCallback;
+    robotPositionTicker_ = clock_->createTicker(
+      [this]() {robotPositionCallback_(robotPose_(clock_->now()).translation());}, period);
+    robotPositionTicker_->start();
+  }
+
+  // fixes use ranges weights given by scheduler diagnostics
+  void enableRangesWeighting()
+  {
+    isRangesWeightingEnabled_ = true;
+  }
+
+  void run(const romea::core::Duration & duration)
+  {
+    romea::core::TimePoint endStamp = clock_->now() + duration;
+    while (true) {
+      romea::core::TimePoint nextStamp = std::min(
+        clock_->getNextTickStamp(), nextExchangeEndStamp_());
+      if (nextStamp > endStamp) {
+        break;
+      }
+
+      clock_->advanceTo(nextStamp);
+      completeExchanges_();
+    }
+    clock_->advanceTo(endStamp);
+  }
+
+  void report(const std::string & name, const double & wallDuration)
+  {
+    double duration = romea::core::durationToSecond(clock_->now() - startStamp_);
+    std::vector<double> fixesIntervals;
+    for (size_t n = 1; n < fixesStamps_.size(); ++n) {
+      fixesIntervals.push_back(fixesStamps_[n] - fixesStamps_[n - 1]);
+    }
+
+    std::cout << std::fixed << std::setprecision(1) << name << " (" << duration <<
+      " s simulated in " << wallDuration * 1000 << " ms)" << std::endl;
+    std::cout << "  " << numberOfRanges_ / duration << " ranges/s, " <<
+      fixesStamps_.size() / duration << " fixes/s, " <<
+      100. * numberOfRanges_ / std::max<size_t>(numberOfRequests_, 1) << " % success, " <<
+      100. * numberOfCollisions_ / std::max<size_t>(numberOfRequests_, 1) << " % collisions" <<
+      std::endl;
+    std::cout << "  exchange latency p50/p95/p99: " <<
+      1000 * percentile_(exchangesLatencies_, 0.5) << "/" <<
+      1000 * percentile_(exchangesLatencies_, 0.95) << "/" <<
+      1000 * percentile_(exchangesLatencies_, 0.99) << " ms" << std::endl;
+    std::cout << "  fix interval p50/p95/p99: " <<
+      1000 * percentile_(fixesIntervals, 0.5) << "/" <<
+      1000 * percentile_(fixesIntervals, 0.95) << "/" <<
+      1000 * percentile_(fixesIntervals, 0.99) << " ms, fix error p50/p95: " <<
+      100 * percentile_(fixesErrors_, 0.5) << "/" <<
+      100 * percentile_(fixesErrors_, 0.95) << " cm" << std::endl;
+  }
+
+private:
+  struct Exchange
+  {
+    size_t initiatorIndex;
+    size_t responderIndex;
+    romea::core::TimePoint requestStamp;
+    romea::core::TimePoint airEndStamp;
+    romea::core::TimePoint endStamp;
+    romea::core::Duration timeout;
+    bool isSuccessful;
+    bool isCollided;
+  };
+
+  Eigen::Affine3d robotPose_(const romea::core::TimePoint & stamp) const
+  {
+    const double radius = 20.0;
+    const double speed = 2.0;
+    double angle = speed / radius * romea::core::durationToSecond(stamp - startStamp_);
+    Eigen::Affine3d pose = Eigen::Affine3d::Identity();
+    pose.translation() = Eigen::Vector3d(
+      30 + radius * std::cos(angle), 30 + radius * std::sin(angle), 0);
+    pose.linear() = Eigen::AngleAxisd(angle + M_PI / 2, Eigen::Vector3d::UnitZ()).matrix();
+    return pose;
+  }
+
+  Eigen::Vector3d initiatorPosition_(
+    const size_t & initiatorIndex,
+    const romea::core::TimePoint & stamp) const
+  {
+    return robotPose_(stamp) * initiatorsPositions_[initiatorIndex];
+  }
+
+  bool isInterfering_(const Exchange & first, const Exchange & second) const
+  {
+    const Eigen::Vector3d firstPositions[2] = {
+      initiatorPosition_(first.initiatorIndex, first.requestStamp),
+      respondersPositions_[first.responderIndex]};
+    const Eigen::Vector3d secondPositions[2] = {
+      initiatorPosition_(second.initiatorIndex, second.requestStamp),
+      respondersPositions_[second.responderIndex]};
+
+    for (const auto & firstPosition : firstPositions) {
+      for (const auto & secondPosition : secondPositions) {
+        if ((firstPosition - secondPosition).norm() < parameters_.interferenceDistance) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  void request_(
+    const size_t & initiatorIndex,
+    const size_t & responderIndex,
+    const romea::core::Duration & timeout)
+  {
+    ++numberOfRequests_;
+    romea::core::TimePoint stamp = clock_->now();
+    double range = (initiatorPosition_(initiatorIndex, stamp) -
+      respondersPositions_[responderIndex]).norm();
+
+    bool isDead = std::find(
+      parameters_.deadResponders.begin(), parameters_.deadResponders.end(),
+      responderIndex) != parameters_.deadResponders.end();
+
+    bool isBlocked = std::find(
+      parameters_.blockedLinks.begin(), parameters_.blockedLinks.end(),
+      std::make_pair(initiatorIndex, responderIndex)) != parameters_.blockedLinks.end();
+
+    double successProbability = 0;
+    if (!isDead && !isBlocked && range < parameters_.maximalRange) {
+      double normalizedRange = range / parameters_.maximalRange;
+      successProbability = parameters_.successProbability *
+        (1 - normalizedRange * normalizedRange);
+    }
+
+    std::uniform_real_distribution<double> jitterDistribution(
+      0, parameters_.exchangeLatencyJitter);
+    auto latency = romea::core::durationFromSecond(
+      parameters_.exchangeBaseLatency + parameters_.exchangeLatencyPerMeter * range +
+      jitterDistribution(generator_));
+
+    Exchange exchange{
+      initiatorIndex, responderIndex, stamp, stamp + latency, stamp + timeout, timeout,
+      false, false};
+    if (latency < timeout && std::bernoulli_distribution(successProbability)(generator_)) {
+      exchange.endStamp = stamp + latency;
+      exchange.isSuccessful = true;
+    }
+
+    // exchanges overlapping on air collide and are both lost, initiators wait until timeout
+    for (auto & inFlightExchange : exchanges_) {
+      if (parameters_.interferenceDistance > 0 && inFlightExchange.airEndStamp > stamp &&
+        isInterfering_(exchange, inFlightExchange))
+      {
+        for (Exchange * collidedExchange : {&exchange, &inFlightExchange}) {
+          if (!collidedExchange->isCollided) {
+            collidedExchange->isCollided = true;
+            ++numberOfCollisions_;
+          }
+          if (collidedExchange->isSuccessful) {
+            collidedExchange->isSuccessful = false;
+            collidedExchange->endStamp =
+              collidedExchange->requestStamp + collidedExchange->timeout;
+          }
+        }
+      }
+    }
+    exchanges_.push_back(exchange);
+  }
+
+  romea::core::TimePoint nextExchangeEndStamp_() const
+  {
+    romea::core::TimePoint stamp = romea::core::TimePoint::max();
+    for (const auto & exchange : exchanges_) {
+      stamp = std::min(stamp, exchange.endStamp);
+    }
+    return stamp;
+  }
+
+  void completeExchanges_()
+  {
+    romea::core::TimePoint stamp = clock_->now();
+    while (nextExchangeEndStamp_() <= stamp) {
+      auto it = std::min_element(
+        exchanges_.begin(), exchanges_.end(),
+        [](const Exchange & first, const Exchange & second) {
+          return first.endStamp < second.endStamp;
+        });
+      Exchange exchange = *it;
+      exchanges_.erase(it);
+
+      romea::core::RTLSTransceiverRangingResult result;
+      if (exchange.isSuccessful) {
+        ++numberOfRanges_;
+        exchangesLatencies_.push_back(
+          romea::core::durationToSecond(exchange.endStamp - exchange.requestStamp));
+        result.range = measureRange_(exchange);
+      }
+
+      aggregator_.update(exchange.initiatorIndex, exchange.responderIndex, result, stamp);
+      scheduler_->feedback(exchange.initiatorIndex, exchange.responderIndex, result);
+    }
+  }
+
+  double measureRange_(const Exchange & exchange)
+  {
+    double range = (initiatorPosition_(exchange.initiatorIndex, exchange.requestStamp) -
+      respondersPositions_[exchange.responderIndex]).norm();
+
+    bool isNoisy = std::find(
+      parameters_.noisyLinks.begin(), parameters_.noisyLinks.end(),
+      std::make_pair(exchange.initiatorIndex, exchange.responderIndex)) !=
+      parameters_.noisyLinks.end();
+
+    std::normal_distribution<double> noiseDistribution(
+      0, isNoisy ? parameters_.noisyLinkRangeStd : parameters_.rangeStd);
+    range += noiseDistribution(generator_);
+    if (std::bernoulli_distribution(parameters_.nlosProbability)(generator_)) {
+      range += std::exponential_distribution<double>(1 / parameters_.nlosMeanBias)(generator_);
+    }
+    return std::max(range, 0.01);
+  }
+
+  void fix_(const romea::core::RTLSRangeAggregator::RangeArray & ranges)
+  {
+    romea::core::TimePoint stamp = clock_->now();
+    for (size_t initiatorIndex = 0; initiatorIndex < ranges.size(); ++initiatorIndex) {
+      size_t numberOfRanges = std::count_if(
+        ranges[initiatorIndex].begin(), ranges[initiatorIndex].end(),
+        [](const std::optional<double> & range) {return range.has_value();});
+
+      if (isRangesWeightingEnabled_) {
+        scheduler_->getRangesWeights(initiatorIndex, rangesWeights_);
+      } else {
+        rangesWeights_.assign(ranges[initiatorIndex].size(), 1.0);
+      }
+
+      if (numberOfRanges >= 3 &&
+        estimator_.init(ranges[initiatorIndex], rangesWeights_) &&
+        estimator_.estimate(20, parameters_.rangeStd))
+      {
+        Eigen::Vector2d error = estimator_.getEstimate().head<2>() -
+          initiatorPosition_(initiatorIndex, stamp).head<2>();
+        fixesErrors_.push_back(error.norm());
+        fixesStamps_.push_back(romea::core::durationToSecond(stamp - startStamp_));
+        return;
+      }
+    }
+  }
+
+  static double percentile_(std::vector<double> values, const double & ratio)
+  {
+    if (values.empty()) {
+      return std::nan("");
+    }
+    size_t index = std::min<size_t>(ratio * values.size(), values.size() - 1);
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return values[index];
+  }
+
+  UWBChannelParameters parameters_;
+  romea::core::VectorOfEigenVector3d respondersPositions_;
+  romea::core::VectorOfEigenVector3d initiatorsPositions_;
+  std::shared_ptr<romea::core::RTLSVirtualClock> clock_;
+  romea::core::TimePoint startStamp_;
+  std::mt19937 generator_;
+  Scheduler * scheduler_;
+  std::unique_ptr<romea::core::RTLSTicker> robotPositionTicker_;
+  RobotPositionCallback robotPositionCallback_;
+  std::vector<Exchange> exchanges_;
+  romea::core::RTLSRangeAggregator aggregator_;
+  romea::core::RTLSPosition2DEstimator estimator_;
+  bool isRangesWeightingEnabled_;
+  std::vector<double> rangesWeights_;
+  size_t numberOfRequests_;
+  size_t numberOfRanges_;
+  size_t numberOfCollisions_;
+  std::vector<double> exchangesLatencies_;
+  std::vector<double> fixesStamps_;
+  std::vector<double> fixesErrors_;
+};
+
+#endif  // UWBCHANNELSIMULATOR_HPP_
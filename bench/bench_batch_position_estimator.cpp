@@ -0,0 +1,101 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// romea
+#include "romea_core_common/containers/Eigen/VectorOfEigenVector.hpp"
+#include "romea_core_rtls/trilateration/RTLSPosition2DEstimator.hpp"
+#include "romea_core_rtls/trilateration/RTLSBatchPosition2DEstimator.hpp"
+
+namespace
+{
+const size_t NUMBER_OF_REPETITIONS = 200;
+const double RANGE_STD = 0.05;
+}
+
+void benchmark(
+  const romea::core::VectorOfEigenVector3d & anchorPositions,
+  const size_t & numberOfTargetTags)
+{
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<double> positionDistribution(-15, 15);
+  std::normal_distribution<double> noiseDistribution(0, RANGE_STD);
+
+  using RangeArray = romea::core::RTLSBatchPosition2DEstimator::RangeArray;
+  RangeArray ranges(anchorPositions.size(), RangeArray::value_type(numberOfTargetTags));
+  std::vector<romea::core::RTLSPosition2DEstimator::RangeVector> tagRanges(
+    numberOfTargetTags, romea::core::RTLSPosition2DEstimator::RangeVector(anchorPositions.size()));
+  for (size_t k = 0; k < numberOfTargetTags; ++k) {
+    Eigen::Vector2d tagPosition(positionDistribution(generator), positionDistribution(generator));
+    for (size_t j = 0; j < anchorPositions.size(); ++j) {
+      ranges[j][k] = tagRanges[k][j] = (tagPosition - anchorPositions[j].head<2>()).norm() +
+        noiseDistribution(generator);
+    }
+  }
+
+  romea::core::RTLSPosition2DEstimator estimator(anchorPositions, 0.001);
+  size_t numberOfScalarSuccesses = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t n = 0; n < NUMBER_OF_REPETITIONS; ++n) {
+    for (size_t k = 0; k < numberOfTargetTags; ++k) {
+      if (estimator.init(tagRanges[k]) && estimator.estimate(20, RANGE_STD)) {
+        ++numberOfScalarSuccesses;
+      }
+    }
+  }
+  auto stop = std::chrono::steady_clock::now();
+  double scalarElapsed = std::chrono::duration<double, std::micro>(stop - start).count();
+
+  romea::core::RTLSBatchPosition2DEstimator batchEstimator(anchorPositions, 0.001);
+  size_t numberOfBatchSuccesses = 0;
+  start = std::chrono::steady_clock::now();
+  for (size_t n = 0; n < NUMBER_OF_REPETITIONS; ++n) {
+    batchEstimator.init(ranges);
+    batchEstimator.estimate(20, RANGE_STD);
+    for (size_t k = 0; k < numberOfTargetTags; ++k) {
+      numberOfBatchSuccesses += batchEstimator.isEstimated(k);
+    }
+  }
+  stop = std::chrono::steady_clock::now();
+  double batchElapsed = std::chrono::duration<double, std::micro>(stop - start).count();
+
+  double numberOfSolves = NUMBER_OF_REPETITIONS * numberOfTargetTags;
+  std::cout << numberOfTargetTags << " tags: scalar " << scalarElapsed / numberOfSolves <<
+    " us/tag (" << numberOfScalarSuccesses / NUMBER_OF_REPETITIONS << " estimated), batch " <<
+    batchElapsed / numberOfSolves << " us/tag (" <<
+    numberOfBatchSuccesses / NUMBER_OF_REPETITIONS << " estimated), speed-up " <<
+    scalarElapsed / batchElapsed << std::endl;
+}
+
+int main()
+{
+  romea::core::VectorOfEigenVector3d anchorPositions = {
+    Eigen::Vector3d(-20, -20, 2),
+    Eigen::Vector3d(20, -20, 2),
+    Eigen::Vector3d(20, 20, 2),
+    Eigen::Vector3d(-20, 20, 2),
+    Eigen::Vector3d(0, 25, 2),
+    Eigen::Vector3d(25, 0, 2)};
+
+  for (size_t numberOfTargetTags : {1, 4, 16, 64, 256}) {
+    benchmark(anchorPositions, numberOfTargetTags);
+  }
+  return 0;
+}
@@ -0,0 +1,134 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// romea
+#include "romea_core_rtls/coordination/RTLSChannelArbiter.hpp"
+#include "romea_core_rtls/coordination/RTLSReachableTransceivers.hpp"
+
+namespace
+{
+const double SITE_SIZE = 200;
+const double ANCHORS_SPACING = 20;
+const double REACHABLE_DISTANCE = 40;
+const size_t NUMBER_OF_ROBOTS = 16;
+const double EXCHANGE_DURATION = 0.003;
+const double SLOT_DURATION = 0.0035;
+const double SIMULATION_DURATION = 10;
+}
+
+struct Exchange
+{
+  size_t robotIndex;
+  double start;
+  double end;
+};
+
+// Exchanges overlapping in time fail when their robots reach a common responder
+size_t countSuccessfulExchanges(
+  std::vector<Exchange> exchanges,
+  const std::vector<std::vector<unsigned char>> & conflicts)
+{
+  std::sort(exchanges.begin(), exchanges.end(), [](const Exchange & a, const Exchange & b) {
+      return a.start < b.start;
+    });
+
+  std::vector<unsigned char> failures(exchanges.size(), 0);
+  for (size_t n = 0; n < exchanges.size(); ++n) {
+    for (size_t m = n + 1; m < exchanges.size() && exchanges[m].start < exchanges[n].end; ++m) {
+      if (conflicts[exchanges[n].robotIndex][exchanges[m].robotIndex]) {
+        failures[n] = failures[m] = 1;
+      }
+    }
+  }
+
+  return exchanges.size() - std::count(failures.begin(), failures.end(), 1);
+}
+
+int main()
+{
+  romea::core::VectorOfEigenVector3d anchorsPositions;
+  for (double x = 0; x <= SITE_SIZE; x += ANCHORS_SPACING) {
+    for (double y = 0; y <= SITE_SIZE; y += ANCHORS_SPACING) {
+      anchorsPositions.emplace_back(x, y, 2);
+    }
+  }
+
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<double> positionDistribution(0, SITE_SIZE);
+  std::uniform_real_distribution<double> jitterDistribution(0, 0.0005);
+
+  romea::core::RTLSReachableTransceivers reachableAnchors(anchorsPositions, REACHABLE_DISTANCE);
+  std::vector<std::vector<size_t>> robotsReachableAnchors;
+  for (size_t n = 0; n < NUMBER_OF_ROBOTS; ++n) {
+    Eigen::Vector3d robotPosition(positionDistribution(generator),
+      positionDistribution(generator), 0);
+    robotsReachableAnchors.push_back(reachableAnchors.find(robotPosition));
+  }
+
+  std::vector<std::vector<unsigned char>> conflicts(
+    NUMBER_OF_ROBOTS, std::vector<unsigned char>(NUMBER_OF_ROBOTS, 0));
+  for (size_t n = 0; n < NUMBER_OF_ROBOTS; ++n) {
+    for (size_t m = 0; m < NUMBER_OF_ROBOTS; ++m) {
+      for (const size_t & anchorIndex : robotsReachableAnchors[n]) {
+        const auto & anchors = robotsReachableAnchors[m];
+        conflicts[n][m] |= n != m &&
+          std::binary_search(anchors.begin(), anchors.end(), anchorIndex);
+      }
+    }
+  }
+
+  // every robot ranges back to back without knowing the others
+  std::vector<Exchange> uncoordinatedExchanges;
+  for (size_t n = 0; n < NUMBER_OF_ROBOTS; ++n) {
+    for (double t = jitterDistribution(generator) * 10; t < SIMULATION_DURATION;
+      t += EXCHANGE_DURATION + jitterDistribution(generator))
+    {
+      uncoordinatedExchanges.push_back({n, t, t + EXCHANGE_DURATION});
+    }
+  }
+
+  // robots only range during slots given by the arbiter
+  auto slots = romea::core::RTLSChannelArbiter::assignSlots(robotsReachableAnchors);
+  size_t numberOfSlots = *std::max_element(slots.begin(), slots.end()) + 1;
+  std::vector<Exchange> arbitratedExchanges;
+  for (size_t n = 0; n < NUMBER_OF_ROBOTS; ++n) {
+    for (double t = slots[n] * SLOT_DURATION; t < SIMULATION_DURATION;
+      t += numberOfSlots * SLOT_DURATION)
+    {
+      arbitratedExchanges.push_back({n, t, t + EXCHANGE_DURATION});
+    }
+  }
+
+  auto report = [](const std::string & name, const std::vector<Exchange> & exchanges,
+      const size_t & numberOfSuccesses) {
+      std::cout << name << ": " << numberOfSuccesses / SIMULATION_DURATION << " ranges/s (" <<
+        100.0 * numberOfSuccesses / exchanges.size() << "% of " <<
+        exchanges.size() / SIMULATION_DURATION << " exchanges/s)" << std::endl;
+    };
+
+  std::cout << NUMBER_OF_ROBOTS << " robots, " << anchorsPositions.size() << " anchors, " <<
+    numberOfSlots << " slots" << std::endl;
+  report("uncoordinated", uncoordinatedExchanges,
+    countSuccessfulExchanges(uncoordinatedExchanges, conflicts));
+  report("arbitrated", arbitratedExchanges,
+    countSuccessfulExchanges(arbitratedExchanges, conflicts));
+  return 0;
+}
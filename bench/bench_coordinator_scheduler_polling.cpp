@@ -0,0 +1,191 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <chrono>
+#include <functional>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <queue>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// romea
+#include "romea_core_rtls/coordination/RTLSPipelinedCoordinatorScheduler.hpp"
+#include "romea_core_rtls/coordination/RTLSSimpleCoordinatorScheduler.hpp"
+
+namespace
+{
+const double POLL_RATE = 20.0;
+const double BENCH_DURATION = 3.0;
+const double SUCCESS_PROBABILITY = 0.8;
+const double EXCHANGE_DURATION = 0.003;
+}
+
+// Simulated radio answering requests on its own thread, like transceiver drivers would:
+// successful exchanges last a few milliseconds whereas failed ones last the whole timeout.
+// Exchanges of different transceivers run in parallel.
+class SimulatedRadio
+{
+public:
+  using Scheduler = romea::core::RTLSSimpleCoordinatorScheduler;
+
+  SimulatedRadio()
+  : scheduler_(nullptr),
+    generator_(0),
+    mutex_(),
+    condition_(),
+    exchanges_(),
+    isRunning_(true),
+    numberOfMeasurements_(0),
+    thread_(&SimulatedRadio::run_, this)
+  {
+  }
+
+  ~SimulatedRadio()
+  {
+    stop();
+  }
+
+  void stop()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      isRunning_ = false;
+    }
+    condition_.notify_one();
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+  }
+
+  void setScheduler(Scheduler * scheduler)
+  {
+    scheduler_ = scheduler;
+  }
+
+  void request(
+    const size_t & initiatorIndex,
+    const size_t & responderIndex,
+    const romea::core::Duration & timeout)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      std::bernoulli_distribution successDistribution(SUCCESS_PROBABILITY);
+      bool success = successDistribution(generator_);
+      auto exchangeDuration = success ?
+        romea::core::durationFromSecond(EXCHANGE_DURATION) : timeout;
+      exchanges_.push({initiatorIndex, responderIndex, success,
+          std::chrono::steady_clock::now() + exchangeDuration});
+    }
+    condition_.notify_one();
+  }
+
+  size_t getNumberOfMeasurements() const
+  {
+    return numberOfMeasurements_;
+  }
+
+private:
+  struct Exchange
+  {
+    size_t initiatorIndex;
+    size_t responderIndex;
+    bool success;
+    std::chrono::steady_clock::time_point end;
+
+    bool operator<(const Exchange & other) const
+    {
+      return end > other.end;
+    }
+  };
+
+  void run_()
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (isRunning_) {
+      if (exchanges_.empty()) {
+        condition_.wait(lock);
+        continue;
+      }
+
+      if (condition_.wait_until(lock, exchanges_.top().end) != std::cv_status::timeout) {
+        continue;
+      }
+
+      Exchange exchange = exchanges_.top();
+      exchanges_.pop();
+      lock.unlock();
+
+      romea::core::RTLSTransceiverRangingResult result;
+      if (exchange.success) {
+        result.range = 10.0;
+        ++numberOfMeasurements_;
+      }
+      scheduler_->feedback(exchange.initiatorIndex, exchange.responderIndex, result);
+
+      lock.lock();
+    }
+  }
+
+  Scheduler * scheduler_;
+  std::mt19937 generator_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::priority_queue<Exchange> exchanges_;
+  bool isRunning_;
+  size_t numberOfMeasurements_;
+  std::thread thread_;
+};
+
+template<typename Scheduler, typename ... Args>
+void benchmark(const std::string & name, Args && ... args)
+{
+  std::vector<std::string> initiatorsNames = {
+    "initiator0", "initiator1", "initiator2", "initiator3"};
+  std::vector<std::string> respondersNames = {
+    "responder0", "responder1", "responder2", "responder3", "responder4", "responder5"};
+
+  SimulatedRadio radio;
+  Scheduler scheduler(
+    POLL_RATE, initiatorsNames, respondersNames,
+    std::bind(
+      &SimulatedRadio::request, &radio,
+      std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
+    std::forward<Args>(args)...);
+  radio.setScheduler(&scheduler);
+
+  scheduler.start();
+  std::this_thread::sleep_for(romea::core::durationFromSecond(BENCH_DURATION));
+  scheduler.stop();
+  radio.stop();
+
+  std::cout << name << ": " << radio.getNumberOfMeasurements() / BENCH_DURATION <<
+    " measurements/s" << std::endl;
+}
+
+int main()
+{
+  using SimpleScheduler = romea::core::RTLSSimpleCoordinatorScheduler;
+  using PipelinedScheduler = romea::core::RTLSPipelinedCoordinatorScheduler;
+
+  benchmark<SimpleScheduler>("timer", SimpleScheduler::PollingMode::TIMER);
+  benchmark<SimpleScheduler>("completion", SimpleScheduler::PollingMode::COMPLETION);
+  benchmark<PipelinedScheduler>("pipelined");
+  return 0;
+}
@@ -0,0 +1,126 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <cmath>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+// romea
+#include "romea_core_rtls/coordination/RTLSInformationGainPairSelector.hpp"
+
+namespace
+{
+const size_t NUMBER_OF_RESPONDERS = 6;
+const double SITE_SIZE = 30;
+const size_t NUMBER_OF_FIXES = 10000;
+const double RANGE_STD = 0.1;
+const double TARGET_POSITION_STD = 0.05;
+const size_t MAXIMAL_NUMBER_OF_EXCHANGES = 100;
+}
+
+// Number of exchanges needed before position covariance trace reaches target,
+// starting from an elongated prior as given by a tracking filter
+size_t exchangesPerFix(
+  const Eigen::Vector3d & position,
+  const Eigen::Matrix2d & priorCovariance,
+  const romea::core::VectorOfEigenVector3d & respondersPositions,
+  romea::core::RTLSInformationGainPairSelector * selector,
+  romea::core::TimePoint & stamp)
+{
+  std::vector<size_t> candidatesIndexes(respondersPositions.size());
+  std::iota(candidatesIndexes.begin(), candidatesIndexes.end(), 0);
+
+  if (selector) {
+    selector->setCovariance(priorCovariance);
+  }
+
+  Eigen::Matrix2d covariance = priorCovariance;
+  double targetTrace = 2 * TARGET_POSITION_STD * TARGET_POSITION_STD;
+  size_t initiatorIndex = 0;
+  size_t responderIndex = 0;
+  for (size_t n = 1; n <= MAXIMAL_NUMBER_OF_EXCHANGES; ++n) {
+    stamp += romea::core::durationFromMilliSecond(50);
+    if (selector) {
+      selector->select(position, candidatesIndexes, stamp, initiatorIndex, responderIndex);
+      covariance = selector->getCovariance();
+    } else {
+      responderIndex = (n - 1) % respondersPositions.size();
+      Eigen::Vector2d lineOfSight =
+        (position - respondersPositions[responderIndex]).head<2>().normalized();
+      Eigen::Vector2d covarianceLineOfSight = covariance * lineOfSight;
+      covariance -= covarianceLineOfSight * covarianceLineOfSight.transpose() /
+        (lineOfSight.dot(covarianceLineOfSight) + RANGE_STD * RANGE_STD);
+    }
+
+    if (covariance.trace() <= targetTrace) {
+      return n;
+    }
+  }
+  return MAXIMAL_NUMBER_OF_EXCHANGES;
+}
+
+int main()
+{
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<double> positionDistribution(0, SITE_SIZE);
+  std::uniform_real_distribution<double> headingDistribution(-M_PI, M_PI);
+
+  romea::core::VectorOfEigenVector3d respondersPositions;
+  for (size_t n = 0; n < NUMBER_OF_RESPONDERS; ++n) {
+    respondersPositions.push_back(Eigen::Vector3d(
+        positionDistribution(generator), positionDistribution(generator), 2.0));
+  }
+
+  // links freshness is not a constraint here, it is only used at startup to poll each link once
+  romea::core::RTLSInformationGainPairSelector selector(
+    1, respondersPositions, RANGE_STD, romea::core::durationFromSecond(1e6));
+  romea::core::TimePoint stamp;
+  std::vector<size_t> candidatesIndexes(respondersPositions.size());
+  std::iota(candidatesIndexes.begin(), candidatesIndexes.end(), 0);
+  size_t initiatorIndex = 0;
+  size_t responderIndex = 0;
+  for (size_t n = 0; n < respondersPositions.size(); ++n) {
+    selector.select(
+      Eigen::Vector3d::Zero(), candidatesIndexes, stamp, initiatorIndex, responderIndex);
+  }
+
+  size_t roundRobinExchanges = 0;
+  size_t informationGainExchanges = 0;
+  for (size_t n = 0; n < NUMBER_OF_FIXES; ++n) {
+    Eigen::Vector3d position(
+      positionDistribution(generator), positionDistribution(generator), 0.0);
+
+    double heading = headingDistribution(generator);
+    Eigen::Matrix2d rotation;
+    rotation << std::cos(heading), -std::sin(heading), std::sin(heading), std::cos(heading);
+    Eigen::Matrix2d priorCovariance =
+      rotation * Eigen::Vector2d(0.5, 0.01).asDiagonal() * rotation.transpose();
+
+    roundRobinExchanges += exchangesPerFix(
+      position, priorCovariance, respondersPositions, nullptr, stamp);
+    informationGainExchanges += exchangesPerFix(
+      position, priorCovariance, respondersPositions, &selector, stamp);
+  }
+
+  std::cout << "round robin: " <<
+    static_cast<double>(roundRobinExchanges) / NUMBER_OF_FIXES << " exchanges/fix" << std::endl;
+  std::cout << "information gain: " <<
+    static_cast<double>(informationGainExchanges) / NUMBER_OF_FIXES << " exchanges/fix" <<
+    std::endl;
+  return 0;
+}
@@ -0,0 +1,104 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// romea
+#include "romea_core_common/pointset/KdTree.hpp"
+#include "romea_core_rtls/coordination/RTLSReachableTransceivers.hpp"
+
+namespace
+{
+const size_t NUMBER_OF_ANCHORS = 100000;
+const double SITE_SIZE = 5000;
+const double RESEARCH_RADIUS = 50;
+const size_t NUMBER_OF_QUERIES = 20000;
+const double ROBOT_STEP = 0.05;
+}
+
+template<typename Research>
+void benchmark(
+  const std::string & name,
+  const std::vector<Eigen::Vector3d> & robotPositions,
+  Research && research)
+{
+  size_t numberOfNeighbors = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (const auto & robotPosition : robotPositions) {
+    numberOfNeighbors += research(robotPosition).size();
+  }
+  auto stop = std::chrono::steady_clock::now();
+
+  double elapsed = std::chrono::duration<double, std::micro>(stop - start).count();
+  std::cout << name << ": " << elapsed / robotPositions.size() << " us/query, " <<
+    static_cast<double>(numberOfNeighbors) / robotPositions.size() << " neighbors/query" <<
+    std::endl;
+}
+
+int main()
+{
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<double> anchorDistribution(0, SITE_SIZE);
+  std::uniform_real_distribution<double> headingDistribution(-0.1, 0.1);
+
+  romea::core::VectorOfEigenVector3d anchorsPositions;
+  for (size_t n = 0; n < NUMBER_OF_ANCHORS; ++n) {
+    anchorsPositions.emplace_back(anchorDistribution(generator), anchorDistribution(generator), 2);
+  }
+
+  // robot drives slowly through the site, as between two selection cycles
+  std::vector<Eigen::Vector3d> robotPositions(NUMBER_OF_QUERIES);
+  Eigen::Vector3d robotPosition(SITE_SIZE / 2, SITE_SIZE / 2, 0);
+  double heading = 0;
+  for (auto & position : robotPositions) {
+    heading += headingDistribution(generator);
+    robotPosition.x() += ROBOT_STEP * std::cos(heading);
+    robotPosition.y() += ROBOT_STEP * std::sin(heading);
+    position = robotPosition;
+  }
+
+  romea::core::KdTree<Eigen::Vector3d> kdTree(anchorsPositions);
+  std::vector<size_t> neighborIndexes;
+  std::vector<double> neighborSquareDistances;
+  using Indexes = std::vector<size_t>;
+
+  benchmark("kdtree", robotPositions, [&](const Eigen::Vector3d & position) -> const Indexes & {
+      kdTree.radiusResearch(
+        position, RESEARCH_RADIUS * RESEARCH_RADIUS, neighborIndexes, neighborSquareDistances);
+      std::sort(neighborIndexes.begin(), neighborIndexes.end());
+      return neighborIndexes;
+    });
+
+  romea::core::RTLSReachableTransceivers grid(anchorsPositions, RESEARCH_RADIUS);
+  benchmark("grid", robotPositions, [&](const Eigen::Vector3d & position) -> const Indexes & {
+      return grid.find(position);
+    });
+
+  romea::core::RTLSReachableTransceivers gridWithHysteresis(anchorsPositions, RESEARCH_RADIUS, 1);
+  benchmark(
+    "grid with 1m hysteresis", robotPositions,
+    [&](const Eigen::Vector3d & position) -> const Indexes & {
+      return gridWithHysteresis.find(position);
+    });
+  std::cout << "  " << gridWithHysteresis.getNumberOfResearches() << " researches for " <<
+    robotPositions.size() << " queries" << std::endl;
+
+  return 0;
+}
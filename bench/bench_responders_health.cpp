@@ -0,0 +1,208 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <chrono>
+#include <functional>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// romea
+#include "romea_core_rtls/coordination/RTLSSimpleCoordinatorScheduler.hpp"
+
+namespace
+{
+const double POLL_RATE = 20.0;
+const double BENCH_DURATION = 5.0;
+const double SUCCESS_PROBABILITY = 0.9;
+const double EXCHANGE_DURATION = 0.003;
+const size_t NUMBER_OF_DEAD_RESPONDERS = 2;
+}
+
+// Simulated radio where last responders never answer: their exchanges always last the
+// whole timeout, this is the air time wasted on dead links.
+class SimulatedRadio
+{
+public:
+  using Scheduler = romea::core::RTLSSimpleCoordinatorScheduler;
+
+  explicit SimulatedRadio(const size_t & numberOfResponders)
+  : scheduler_(nullptr),
+    numberOfResponders_(numberOfResponders),
+    generator_(0),
+    mutex_(),
+    condition_(),
+    exchanges_(),
+    isRunning_(true),
+    numberOfMeasurements_(0),
+    deadLinksAirTime_(0),
+    thread_(&SimulatedRadio::run_, this)
+  {
+  }
+
+  ~SimulatedRadio()
+  {
+    stop();
+  }
+
+  void stop()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      isRunning_ = false;
+    }
+    condition_.notify_one();
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+  }
+
+  void setScheduler(Scheduler * scheduler)
+  {
+    scheduler_ = scheduler;
+  }
+
+  void request(
+    const size_t & initiatorIndex,
+    const size_t & responderIndex,
+    const romea::core::Duration & timeout)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      bool isDead = responderIndex + NUMBER_OF_DEAD_RESPONDERS >= numberOfResponders_;
+      std::bernoulli_distribution successDistribution(SUCCESS_PROBABILITY);
+      bool success = !isDead && successDistribution(generator_);
+      auto exchangeDuration = success ?
+        romea::core::durationFromSecond(EXCHANGE_DURATION) : timeout;
+      if (isDead) {
+        deadLinksAirTime_ += exchangeDuration;
+      }
+      exchanges_.push({initiatorIndex, responderIndex, success,
+          std::chrono::steady_clock::now() + exchangeDuration});
+    }
+    condition_.notify_one();
+  }
+
+  size_t getNumberOfMeasurements() const
+  {
+    return numberOfMeasurements_;
+  }
+
+  romea::core::Duration getDeadLinksAirTime() const
+  {
+    return deadLinksAirTime_;
+  }
+
+private:
+  struct Exchange
+  {
+    size_t initiatorIndex;
+    size_t responderIndex;
+    bool success;
+    std::chrono::steady_clock::time_point end;
+
+    bool operator<(const Exchange & other) const
+    {
+      return end > other.end;
+    }
+  };
+
+  void run_()
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (isRunning_) {
+      if (exchanges_.empty()) {
+        condition_.wait(lock);
+        continue;
+      }
+
+      if (condition_.wait_until(lock, exchanges_.top().end) != std::cv_status::timeout) {
+        continue;
+      }
+
+      Exchange exchange = exchanges_.top();
+      exchanges_.pop();
+      lock.unlock();
+
+      romea::core::RTLSTransceiverRangingResult result;
+      if (exchange.success) {
+        result.range = 10.0;
+        ++numberOfMeasurements_;
+      }
+      scheduler_->feedback(exchange.initiatorIndex, exchange.responderIndex, result);
+
+      lock.lock();
+    }
+  }
+
+  Scheduler * scheduler_;
+  size_t numberOfResponders_;
+  std::mt19937 generator_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::priority_queue<Exchange> exchanges_;
+  bool isRunning_;
+  size_t numberOfMeasurements_;
+  romea::core::Duration deadLinksAirTime_;
+  std::thread thread_;
+};
+
+void benchmark(
+  const std::string & name,
+  const romea::core::RTLSSimpleCoordinatorScheduler::PollingMode & pollingMode,
+  const bool & isHealthAware)
+{
+  std::vector<std::string> initiatorsNames = {"initiator0", "initiator1"};
+  std::vector<std::string> respondersNames = {
+    "responder0", "responder1", "responder2", "responder3", "responder4", "responder5"};
+
+  SimulatedRadio radio(respondersNames.size());
+  romea::core::RTLSSimpleCoordinatorScheduler scheduler(
+    POLL_RATE, initiatorsNames, respondersNames,
+    std::bind(
+      &SimulatedRadio::request, &radio,
+      std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
+    pollingMode);
+  if (isHealthAware) {
+    scheduler.enableHealthAwareRotation();
+  }
+  radio.setScheduler(&scheduler);
+
+  scheduler.start();
+  std::this_thread::sleep_for(romea::core::durationFromSecond(BENCH_DURATION));
+  scheduler.stop();
+  radio.stop();
+
+  std::cout << name << ": " <<
+    100 * romea::core::durationToSecond(radio.getDeadLinksAirTime()) / BENCH_DURATION <<
+    " % of air time on dead links, " <<
+    radio.getNumberOfMeasurements() / BENCH_DURATION << " measurements/s" << std::endl;
+}
+
+int main()
+{
+  using PollingMode = romea::core::RTLSSimpleCoordinatorScheduler::PollingMode;
+
+  benchmark("timer", PollingMode::TIMER, false);
+  benchmark("timer health aware", PollingMode::TIMER, true);
+  benchmark("completion", PollingMode::COMPLETION, false);
+  benchmark("completion health aware", PollingMode::COMPLETION, true);
+  return 0;
+}
@@ -0,0 +1,97 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// romea
+#include "romea_core_common/containers/Eigen/VectorOfEigenVector.hpp"
+#include "romea_core_rtls/trilateration/RTLSPosition2DEstimator.hpp"
+#include "romea_core_rtls/trilateration/RTLSRobustPosition2DEstimator.hpp"
+
+namespace
+{
+const size_t NUMBER_OF_SOLVES = 10000;
+const double RANGE_STD = 0.05;
+const double NLOS_BIAS = 3.0;
+}
+
+template<typename Estimator>
+void benchmark(
+  const std::string & name,
+  Estimator & estimator,
+  const std::vector<Eigen::Vector2d> & tagPositions,
+  const std::vector<romea::core::RTLSPosition2DEstimator::RangeVector> & ranges)
+{
+  size_t numberOfSuccesses = 0;
+  double squaredError = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  for (size_t n = 0; n < ranges.size(); ++n) {
+    if (estimator.init(ranges[n]) && estimator.estimate(20, RANGE_STD)) {
+      squaredError += (estimator.getEstimate() - tagPositions[n]).squaredNorm();
+      ++numberOfSuccesses;
+    }
+  }
+  auto stop = std::chrono::steady_clock::now();
+
+  double elapsed = std::chrono::duration<double, std::micro>(stop - start).count();
+  std::cout << name << ": " << elapsed / ranges.size() << " us/solve, " <<
+    numberOfSuccesses << "/" << ranges.size() << " successes, rmse " <<
+    std::sqrt(squaredError / numberOfSuccesses) << " m" << std::endl;
+}
+
+int main()
+{
+  romea::core::VectorOfEigenVector3d anchorPositions = {
+    Eigen::Vector3d(-20, -20, 2),
+    Eigen::Vector3d(20, -20, 2),
+    Eigen::Vector3d(20, 20, 2),
+    Eigen::Vector3d(-20, 20, 2),
+    Eigen::Vector3d(0, 25, 2),
+    Eigen::Vector3d(25, 0, 2)};
+
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<double> positionDistribution(-15, 15);
+  std::uniform_int_distribution<size_t> anchorDistribution(0, anchorPositions.size() - 1);
+  std::normal_distribution<double> noiseDistribution(0, RANGE_STD);
+
+  std::vector<Eigen::Vector2d> tagPositions(NUMBER_OF_SOLVES);
+  std::vector<romea::core::RTLSPosition2DEstimator::RangeVector> ranges(NUMBER_OF_SOLVES);
+  for (size_t n = 0; n < NUMBER_OF_SOLVES; ++n) {
+    tagPositions[n].x() = positionDistribution(generator);
+    tagPositions[n].y() = positionDistribution(generator);
+    for (const auto & anchorPosition : anchorPositions) {
+      ranges[n].push_back((tagPositions[n] - anchorPosition.head<2>()).norm() +
+        noiseDistribution(generator));
+    }
+    *ranges[n][anchorDistribution(generator)] += NLOS_BIAS;
+  }
+
+  romea::core::RTLSPosition2DEstimator estimator(anchorPositions, 0.001);
+  romea::core::RTLSRobustPosition2DEstimator huberEstimator(
+    anchorPositions, 0.001, romea::core::RTLSRobustPosition2DEstimator::Loss::HUBER);
+  romea::core::RTLSRobustPosition2DEstimator tukeyEstimator(
+    anchorPositions, 0.001, romea::core::RTLSRobustPosition2DEstimator::Loss::TUKEY);
+
+  benchmark("plain", estimator, tagPositions, ranges);
+  benchmark("huber", huberEstimator, tagPositions, ranges);
+  benchmark("tukey", tukeyEstimator, tagPositions, ranges);
+  return 0;
+}
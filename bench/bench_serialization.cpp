@@ -0,0 +1,141 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// romea
+#include "romea_core_rtls/serialization/Pose2DSerialization.hpp"
+#include "romea_core_rtls/serialization/Quantization.hpp"
+#include "romea_core_rtls/serialization/Twist2DSerialization.hpp"
+
+namespace
+{
+const size_t NUMBER_OF_POSES = 64;
+const size_t NUMBER_OF_BROADCASTS = 20000;
+}
+
+// every broadcast encodes then decodes a set of poses, checksum keeps work from being elided
+template<typename Function>
+void benchmark(const std::string & name, Function broadcast)
+{
+  size_t checksum = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t n = 0; n < NUMBER_OF_BROADCASTS; ++n) {
+    checksum += broadcast();
+  }
+  auto stop = std::chrono::steady_clock::now();
+
+  double elapsed = std::chrono::duration<double, std::nano>(stop - start).count();
+  std::cout << name << ": " << elapsed / (NUMBER_OF_BROADCASTS * NUMBER_OF_POSES) <<
+    " ns/pose (checksum " << checksum << ")" << std::endl;
+}
+
+int main()
+{
+  std::vector<romea::core::Pose2D> poses(NUMBER_OF_POSES);
+  std::vector<romea::core::Twist2D> twists(NUMBER_OF_POSES);
+  for (size_t n = 0; n < NUMBER_OF_POSES; ++n) {
+    poses[n].position = Eigen::Vector2d(1.5 * n, -0.5 * n);
+    poses[n].yaw = 0.01 * n;
+    poses[n].covariance.diagonal() << 0.01, 0.01, 0.001;
+    twists[n].linearSpeeds = Eigen::Vector2d(0.05 * n, 0.01 * n);
+    twists[n].angularSpeed = 0.01 * n;
+    twists[n].covariance.diagonal() << 0.01, 0.01, 0.001;
+  }
+
+  std::vector<romea::core::Pose2D> deserializedPoses(NUMBER_OF_POSES);
+  std::vector<romea::core::Twist2D> deserializedTwists(NUMBER_OF_POSES);
+
+  benchmark(
+    "pose2d vectors", [&]() {
+      for (size_t n = 0; n < NUMBER_OF_POSES; ++n) {
+        deserializedPoses[n] = romea::core::deserializePose2D(
+          romea::core::serializePose2D(poses[n]));
+      }
+      return static_cast<size_t>(deserializedPoses.back().position.x());
+    });
+
+  romea::core::SerializedPose2D poseBuffer;
+  benchmark(
+    "pose2d arrays", [&]() {
+      for (size_t n = 0; n < NUMBER_OF_POSES; ++n) {
+        romea::core::serializePose2D(poses[n], poseBuffer);
+        deserializedPoses[n] = romea::core::deserializePose2D(poseBuffer);
+      }
+      return static_cast<size_t>(deserializedPoses.back().position.x());
+    });
+
+  std::vector<unsigned char> posesBuffer(NUMBER_OF_POSES * romea::core::POSE2D_SERIALIZED_SIZE);
+  benchmark(
+    "pose2d batch", [&]() {
+      romea::core::serializePose2DBatch(poses.data(), poses.size(), posesBuffer.data());
+      romea::core::deserializePose2DBatch(
+        posesBuffer.data(), poses.size(), deserializedPoses.data());
+      return static_cast<size_t>(deserializedPoses.back().position.x());
+    });
+
+  benchmark(
+    "twist2d vectors", [&]() {
+      for (size_t n = 0; n < NUMBER_OF_POSES; ++n) {
+        deserializedTwists[n] = romea::core::deserializeTwist2D(
+          romea::core::serializeTwist2D(twists[n]));
+      }
+      return static_cast<size_t>(deserializedTwists.back().linearSpeeds.x());
+    });
+
+  std::vector<unsigned char> twistsBuffer(
+    NUMBER_OF_POSES * romea::core::TWIST2D_SERIALIZED_SIZE);
+  benchmark(
+    "twist2d batch", [&]() {
+      romea::core::serializeTwist2DBatch(twists.data(), twists.size(), twistsBuffer.data());
+      romea::core::deserializeTwist2DBatch(
+        twistsBuffer.data(), twists.size(), deserializedTwists.data());
+      return static_cast<size_t>(deserializedTwists.back().linearSpeeds.x());
+    });
+
+  // telemetry packets laid out field by field, coordinates are encoded then decoded
+  std::vector<double> coordinates(NUMBER_OF_POSES), decodedCoordinates(NUMBER_OF_POSES);
+  for (size_t n = 0; n < NUMBER_OF_POSES; ++n) {
+    coordinates[n] = poses[n].position.x();
+  }
+
+  std::vector<unsigned char> coordinatesBuffer(4 * NUMBER_OF_POSES);
+  benchmark(
+    "cartesian coordinates scalar codec", [&]() {
+      for (size_t n = 0; n < NUMBER_OF_POSES; ++n) {
+        romea::core::serializeCartesianCoordinate(coordinates[n], &coordinatesBuffer[4 * n]);
+      }
+      for (size_t n = 0; n < NUMBER_OF_POSES; ++n) {
+        romea::core::deserializeCartesianCoordinate(
+          &coordinatesBuffer[4 * n], decodedCoordinates[n]);
+      }
+      return static_cast<size_t>(decodedCoordinates.back());
+    });
+
+  std::vector<uint32_t> coordinatesCodes(NUMBER_OF_POSES);
+  benchmark(
+    "cartesian coordinates batch kernels", [&]() {
+      romea::core::quantizeCartesianCoordinates(
+        coordinates.data(), NUMBER_OF_POSES, coordinatesCodes.data());
+      romea::core::dequantizeCartesianCoordinates(
+        coordinatesCodes.data(), NUMBER_OF_POSES, decodedCoordinates.data());
+      return static_cast<size_t>(decodedCoordinates.back());
+    });
+
+  return 0;
+}
@@ -0,0 +1,224 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// romea
+#include "romea_core_common/diagnostic/CheckupReliability.hpp"
+#include "romea_core_common/monitoring/OnlineAverage.hpp"
+#include "romea_core_rtls/coordination/RTLSTransceiversDiagnostics.hpp"
+
+namespace
+{
+const double POLL_RATE = 20.0;
+const size_t NUMBER_OF_INITIATORS = 2;
+const size_t NUMBER_OF_RESPONDERS = 64;
+const size_t NUMBER_OF_UPDATES = 2000000;
+const size_t NUMBER_OF_REPORTS = 2000;
+
+romea::core::TimePoint stamp(const size_t & pollIndex)
+{
+  return romea::core::TimePoint(romea::core::durationFromSecond(pollIndex / POLL_RATE));
+}
+}
+
+// Previous layout: one heap allocated average and checkup per transceiver,
+// both evaluated under a single mutex on each update
+class PointerChasingDiagnostics
+{
+public:
+  PointerChasingDiagnostics(
+    const std::vector<std::string> & initiatorsNames,
+    const std::vector<std::string> & respondersNames)
+  : mutex_(),
+    initiatorMonitorings_(),
+    initiatorDiagnostics_(),
+    responderMonitorings_(),
+    responderDiagnostics_()
+  {
+    for (const auto & name : initiatorsNames) {
+      initiatorMonitorings_.push_back(
+        std::make_unique<romea::core::OnlineAverage>(0.0001, 2 * POLL_RATE / NUMBER_OF_INITIATORS));
+      initiatorDiagnostics_.push_back(
+        std::make_unique<romea::core::CheckupReliability>(name, 0.3, 0.8));
+    }
+    for (const auto & name : respondersNames) {
+      responderMonitorings_.push_back(
+        std::make_unique<romea::core::OnlineAverage>(0.0001, 2 * POLL_RATE / NUMBER_OF_RESPONDERS));
+      responderDiagnostics_.push_back(
+        std::make_unique<romea::core::CheckupReliability>(name, 0.3, 0.8));
+    }
+  }
+
+  void update(
+    const size_t & initiatorIndex,
+    const size_t & responderIndex,
+    const romea::core::RTLSTransceiverRangingResult & result,
+    const romea::core::TimePoint &)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    bool isSuccessful = !romea::core::isEmpty(result);
+    initiatorMonitorings_[initiatorIndex]->update(isSuccessful ? 1 : 1 / 3.);
+    initiatorDiagnostics_[initiatorIndex]->evaluate(
+      initiatorMonitorings_[initiatorIndex]->getAverage());
+    responderMonitorings_[responderIndex]->update(isSuccessful ? 1 : 0);
+    responderDiagnostics_[responderIndex]->evaluate(
+      responderMonitorings_[responderIndex]->getAverage());
+  }
+
+  bool isResponderReliable(const size_t & responderIndex) const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return responderDiagnostics_[responderIndex]->getStatus() !=
+           romea::core::DiagnosticStatus::ERROR;
+  }
+
+  romea::core::DiagnosticReport getReport() const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    romea::core::DiagnosticReport report;
+    for (const auto & diagnostic : initiatorDiagnostics_) {
+      report += diagnostic->getReport();
+    }
+    for (const auto & diagnostic : responderDiagnostics_) {
+      report += diagnostic->getReport();
+    }
+    return report;
+  }
+
+private:
+  mutable std::mutex mutex_;
+  std::vector<std::unique_ptr<romea::core::OnlineAverage>> initiatorMonitorings_;
+  std::vector<std::unique_ptr<romea::core::CheckupReliability>> initiatorDiagnostics_;
+  std::vector<std::unique_ptr<romea::core::OnlineAverage>> responderMonitorings_;
+  std::vector<std::unique_ptr<romea::core::CheckupReliability>> responderDiagnostics_;
+};
+
+std::vector<std::string> names(const std::string & prefix, const size_t & size)
+{
+  std::vector<std::string> names;
+  for (size_t n = 0; n < size; ++n) {
+    names.push_back(prefix + std::to_string(n));
+  }
+  return names;
+}
+
+// Feedback threads update diagnostics as fast as possible, sharing updates
+// between them, while a reporting thread keeps querying responders reliabilities
+template<typename Diagnostics>
+void bench(const std::string & name, Diagnostics & diagnostics, const size_t & numberOfWriters)
+{
+  std::mt19937 generator(0);
+  std::bernoulli_distribution successDistribution(0.8);
+  std::vector<romea::core::RTLSTransceiverRangingResult> results(1024);
+  for (auto & result : results) {
+    result.range = successDistribution(generator) ? 10.0 : 0.0;
+  }
+
+  std::atomic<bool> isRunning(true);
+  size_t numberOfReads = 0;
+  std::thread reporter([&]() {
+      size_t numberOfReliableResponders = 0;
+      while (isRunning) {
+        for (size_t r = 0; r < NUMBER_OF_RESPONDERS; ++r) {
+          numberOfReliableResponders += diagnostics.isResponderReliable(r);
+        }
+        ++numberOfReads;
+      }
+      numberOfReads += numberOfReliableResponders == 0;
+    });
+
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> writers;
+  for (size_t w = 0; w < numberOfWriters; ++w) {
+    writers.emplace_back([&, w]() {
+        for (size_t n = w; n < NUMBER_OF_UPDATES; n += numberOfWriters) {
+          diagnostics.update(
+            n % NUMBER_OF_INITIATORS, n % NUMBER_OF_RESPONDERS, results[n % results.size()],
+            stamp(n));
+        }
+      });
+  }
+  for (auto & writer : writers) {
+    writer.join();
+  }
+  auto stop = std::chrono::steady_clock::now();
+  isRunning = false;
+  reporter.join();
+
+  double duration = std::chrono::duration<double>(stop - start).count();
+  std::cout << name << ", " << numberOfWriters << " writer(s): " <<
+    duration * 1e9 / NUMBER_OF_UPDATES << " ns/update, " <<
+    numberOfReads / duration << " reliability sweeps/s" << std::endl;
+}
+
+// Reports are requested after each poll, as a diagnostics publisher would do,
+// only the polled transceivers changing between two of them
+template<typename Diagnostics, typename Function>
+void benchReports(const std::string & name, Diagnostics & diagnostics, Function getReport)
+{
+  romea::core::RTLSTransceiverRangingResult result;
+  size_t numberOfEntries = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  for (size_t n = 0; n < NUMBER_OF_REPORTS; ++n) {
+    result.range = n % 5 ? 10.0 : 0.0;
+    diagnostics.update(n % NUMBER_OF_INITIATORS, n % NUMBER_OF_RESPONDERS, result, stamp(n));
+    numberOfEntries += getReport();
+  }
+  auto stop = std::chrono::steady_clock::now();
+
+  double duration = std::chrono::duration<double>(stop - start).count();
+  std::cout << name << ": " << duration * 1e6 / NUMBER_OF_REPORTS << " us/report (" <<
+    numberOfEntries / NUMBER_OF_REPORTS << " entries)" << std::endl;
+}
+
+int main()
+{
+  auto initiatorsNames = names("initiator", NUMBER_OF_INITIATORS);
+  auto respondersNames = names("responder", NUMBER_OF_RESPONDERS);
+
+  PointerChasingDiagnostics pointerChasingDiagnostics(initiatorsNames, respondersNames);
+  romea::core::RTLSTransceiversDiagnostics diagnostics(
+    POLL_RATE, initiatorsNames, respondersNames);
+  for (const size_t & numberOfWriters : {1, 4}) {
+    bench("pointer chasing", pointerChasingDiagnostics, numberOfWriters);
+    bench("flat stores", diagnostics, numberOfWriters);
+  }
+
+  benchReports("rendered reports", pointerChasingDiagnostics, [&]() {
+      return pointerChasingDiagnostics.getReport().diagnostics.size();
+    });
+  benchReports("cached reports", diagnostics, [&]() {
+      return diagnostics.getReport().diagnostics.size();
+    });
+  std::vector<romea::core::RTLSTransceiverReliability> reliabilities;
+  benchReports("numeric snapshots", diagnostics, [&]() {
+      diagnostics.getInitiatorsReliabilities(reliabilities);
+      size_t numberOfReliabilities = reliabilities.size();
+      diagnostics.getRespondersReliabilities(reliabilities);
+      return numberOfReliabilities + reliabilities.size();
+    });
+
+  return 0;
+}
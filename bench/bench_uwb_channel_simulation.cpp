@@ -0,0 +1,187 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+// romea
+#include "romea_core_rtls/coordination/RTLSGeoreferencedCoordinatorScheduler.hpp"
+#include "romea_core_rtls/coordination/RTLSPipelinedCoordinatorScheduler.hpp"
+#include "romea_core_rtls/coordination/RTLSSimpleCoordinatorScheduler.hpp"
+#include "UWBChannelSimulator.hpp"
+
+namespace
+{
+const double POLL_RATE = 20.0;
+const double SIMULATION_DURATION = 3600.0;
+const double ROBOT_POSITION_PERIOD = 0.1;
+}
+
+using PollingMode = romea::core::RTLSSimpleCoordinatorScheduler::PollingMode;
+
+std::vector<std::string> names(const std::string & prefix, const size_t & size)
+{
+  std::vector<std::string> names;
+  for (size_t n = 0; n < size; ++n) {
+    names.push_back(prefix + std::to_string(n));
+  }
+  return names;
+}
+
+// Scheduler is built by factory from simulator ranging request callback and virtual clock,
+// setup is called before start to enable optional policies
+template<typename Scheduler>
+void simulate(
+  const std::string & name,
+  const UWBChannelParameters & parameters,
+  std::function<std::unique_ptr<Scheduler>(
+    romea::core::RTLSSimpleCoordinatorScheduler::RangingRequestCallback,
+    std::shared_ptr<romea::core::RTLSClock>)> factory,
+  std::function<void(Scheduler &, UWBChannelSimulator &)> setup = nullptr)
+{
+  romea::core::VectorOfEigenVector3d respondersPositions = {
+    Eigen::Vector3d(0, 0, 1.5), Eigen::Vector3d(30, 0, 1.5), Eigen::Vector3d(60, 0, 1.5),
+    Eigen::Vector3d(60, 30, 1.5), Eigen::Vector3d(60, 60, 1.5), Eigen::Vector3d(30, 60, 1.5),
+    Eigen::Vector3d(0, 60, 1.5), Eigen::Vector3d(0, 30, 1.5)};
+  romea::core::VectorOfEigenVector3d initiatorsPositions = {
+    Eigen::Vector3d(0.5, 0.3, 1.5), Eigen::Vector3d(-0.5, -0.3, 1.5)};
+
+  auto clock = std::make_shared<romea::core::RTLSVirtualClock>();
+  UWBChannelSimulator simulator(parameters, respondersPositions, initiatorsPositions, clock);
+  auto scheduler = factory(simulator.getRangingRequestCallback(), clock);
+  simulator.setScheduler(scheduler.get());
+  if (setup) {
+    setup(*scheduler, simulator);
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  scheduler->start();
+  simulator.run(romea::core::durationFromSecond(SIMULATION_DURATION));
+  scheduler->stop();
+  auto stop = std::chrono::steady_clock::now();
+
+  simulator.report(name, std::chrono::duration<double>(stop - start).count());
+}
+
+int main()
+{
+  using SimpleScheduler = romea::core::RTLSSimpleCoordinatorScheduler;
+  using PipelinedScheduler = romea::core::RTLSPipelinedCoordinatorScheduler;
+  using GeoreferencedScheduler = romea::core::RTLSGeoreferencedCoordinatorScheduler;
+  using Callback = SimpleScheduler::RangingRequestCallback;
+  using Clock = std::shared_ptr<romea::core::RTLSClock>;
+
+  UWBChannelParameters parameters;
+  parameters.deadResponders = {7};
+
+  auto simpleFactory = [](const PollingMode & pollingMode) {
+      return [pollingMode](Callback callback, Clock clock) {
+               return std::make_unique<SimpleScheduler>(
+                 POLL_RATE, names("initiator", 2), names("responder", 8),
+                 callback, pollingMode, clock);
+             };
+    };
+
+  simulate<SimpleScheduler>("simple timer", parameters, simpleFactory(PollingMode::TIMER));
+  simulate<SimpleScheduler>(
+    "simple completion", parameters, simpleFactory(PollingMode::COMPLETION));
+  simulate<SimpleScheduler>(
+    "simple completion, adaptive timeouts, health aware", parameters,
+    simpleFactory(PollingMode::COMPLETION),
+    [](SimpleScheduler & scheduler, UWBChannelSimulator &) {
+      scheduler.enableAdaptiveTimeouts();
+      scheduler.enableHealthAwareRotation();
+    });
+
+  UWBChannelParameters blockedLinksParameters = parameters;
+  blockedLinksParameters.blockedLinks = {{0, 0}, {0, 3}, {1, 1}, {1, 5}};
+  simulate<SimpleScheduler>(
+    "simple completion, blocked links, adaptive timeouts, health aware", blockedLinksParameters,
+    simpleFactory(PollingMode::COMPLETION),
+    [](SimpleScheduler & scheduler, UWBChannelSimulator &) {
+      scheduler.enableAdaptiveTimeouts();
+      scheduler.enableHealthAwareRotation();
+    });
+  simulate<SimpleScheduler>(
+    "simple completion, blocked links, adaptive timeouts, health aware, links pruning",
+    blockedLinksParameters, simpleFactory(PollingMode::COMPLETION),
+    [](SimpleScheduler & scheduler, UWBChannelSimulator &) {
+      scheduler.enableAdaptiveTimeouts();
+      scheduler.enableHealthAwareRotation();
+      scheduler.enableLinksPruning();
+    });
+
+  UWBChannelParameters noisyLinksParameters = parameters;
+  noisyLinksParameters.noisyLinks = {{0, 2}, {0, 4}, {1, 0}, {1, 6}};
+  simulate<SimpleScheduler>(
+    "simple completion, noisy links, adaptive timeouts, health aware", noisyLinksParameters,
+    simpleFactory(PollingMode::COMPLETION),
+    [](SimpleScheduler & scheduler, UWBChannelSimulator &) {
+      scheduler.enableAdaptiveTimeouts();
+      scheduler.enableHealthAwareRotation();
+    });
+  simulate<SimpleScheduler>(
+    "simple completion, noisy links, adaptive timeouts, health aware, ranges weighting",
+    noisyLinksParameters, simpleFactory(PollingMode::COMPLETION),
+    [](SimpleScheduler & scheduler, UWBChannelSimulator & simulator) {
+      scheduler.enableAdaptiveTimeouts();
+      scheduler.enableHealthAwareRotation();
+      simulator.enableRangesWeighting();
+    });
+
+  simulate<PipelinedScheduler>(
+    "pipelined", parameters,
+    [](Callback callback, Clock clock) {
+      return std::make_unique<PipelinedScheduler>(
+        POLL_RATE, names("initiator", 2), names("responder", 8), callback, clock);
+    });
+
+  UWBChannelParameters separateChannelsParameters = parameters;
+  separateChannelsParameters.interferenceDistance = 0;
+  simulate<PipelinedScheduler>(
+    "pipelined, separate channels", separateChannelsParameters,
+    [](Callback callback, Clock clock) {
+      return std::make_unique<PipelinedScheduler>(
+        POLL_RATE, names("initiator", 2), names("responder", 8), callback, clock);
+    });
+
+  simulate<GeoreferencedScheduler>(
+    "georeferenced completion, 4 responders selected by GDOP", parameters,
+    [](Callback callback, Clock clock) {
+      romea::core::VectorOfEigenVector3d respondersPositions = {
+        Eigen::Vector3d(0, 0, 1.5), Eigen::Vector3d(30, 0, 1.5), Eigen::Vector3d(60, 0, 1.5),
+        Eigen::Vector3d(60, 30, 1.5), Eigen::Vector3d(60, 60, 1.5), Eigen::Vector3d(30, 60, 1.5),
+        Eigen::Vector3d(0, 60, 1.5), Eigen::Vector3d(0, 30, 1.5)};
+      return std::make_unique<GeoreferencedScheduler>(
+        POLL_RATE, 45.0,
+        names("initiator", 2), romea::core::VectorOfEigenVector3d{
+          Eigen::Vector3d(0.5, 0.3, 1.5), Eigen::Vector3d(-0.5, -0.3, 1.5)},
+        names("responder", 8), respondersPositions,
+        callback, PollingMode::COMPLETION, clock);
+    },
+    [](GeoreferencedScheduler & scheduler, UWBChannelSimulator & simulator) {
+      scheduler.setMaximalNumberOfSelectedResponders(4);
+      scheduler.enableHealthAwareRotation();
+      simulator.setRobotPositionCallback(
+        std::bind(
+          &GeoreferencedScheduler::updateRobotPosition, &scheduler, std::placeholders::_1),
+        romea::core::durationFromSecond(ROBOT_POSITION_PERIOD));
+    });
+
+  return 0;
+}
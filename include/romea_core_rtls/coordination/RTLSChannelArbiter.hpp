@@ -0,0 +1,118 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ROMEA_CORE_RTLS__COORDINATION__RTLSCHANNELARBITER_HPP_
+#define ROMEA_CORE_RTLS__COORDINATION__RTLSCHANNELARBITER_HPP_
+
+// std
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// romea
+#include "romea_core_rtls/coordination/RTLSClock.hpp"
+#include "romea_core_rtls/coordination/RTLSSimpleCoordinatorScheduler.hpp"
+
+namespace romea
+{
+namespace core
+{
+
+// Shares responders between several robots: robots reaching a common
+// responder are given different time slots (greedy coloring of the conflict
+// graph) and their ranging requests are only forwarded during their slot
+class RTLSChannelArbiter
+{
+public:
+  using RangingRequestCallback = RTLSSimpleCoordinatorScheduler::RangingRequestCallback;
+  using RangingDispatchCallback = RangingRequestCallback;
+  using RangingDropCallback = std::function<void (
+        const size_t & /*initiarIndex*/,
+        const size_t & /*responderIndex*/)>;
+
+public:
+  explicit RTLSChannelArbiter(
+    const Duration & slotDuration,
+    std::shared_ptr<RTLSClock> clock = std::make_shared<RTLSSystemClock>());
+
+  // robots must be added before start, dispatch callback is called with the timeout given
+  // to the robot just before its delayed request is forwarded (see scheduler dispatch),
+  // drop callback is called when a pending request is replaced before its slot comes
+  size_t addRobot(
+    RangingRequestCallback rangingRequestCallback,
+    RangingDispatchCallback rangingDispatchCallback = nullptr,
+    RangingDropCallback rangingDropCallback = nullptr);
+
+  void updateRobotReachableResponders(
+    const size_t & robotIndex,
+    const std::vector<size_t> & respondersIndexes);
+
+  RangingRequestCallback getRangingRequestCallback(const size_t & robotIndex);
+
+  void start();
+
+  void stop();
+
+  size_t getNumberOfSlots();
+
+  size_t getRobotSlot(const size_t & robotIndex);
+
+  size_t getNumberOfDroppedRequests(const size_t & robotIndex);
+
+  static std::vector<size_t> assignSlots(
+    const std::vector<std::vector<size_t>> & robotsReachableResponders);
+
+private:
+  void timerCallback_();
+
+  void request_(
+    const size_t & robotIndex,
+    const size_t & initiatorIndex,
+    const size_t & responderIndex,
+    const Duration & timeout);
+
+  void updateSlots_();
+
+private:
+  struct RangingRequest
+  {
+    size_t robotIndex;
+    size_t initiatorIndex;
+    size_t responderIndex;
+    Duration timeout;
+  };
+
+  std::mutex mutex_;
+  Duration slotDuration_;
+  std::vector<RangingRequestCallback> robotsRangingRequestCallbacks_;
+  std::vector<RangingDispatchCallback> robotsRangingDispatchCallbacks_;
+  std::vector<RangingDropCallback> robotsRangingDropCallbacks_;
+  std::vector<std::vector<size_t>> robotsReachableResponders_;
+  std::vector<size_t> robotsSlots_;
+  std::vector<unsigned char> robotsPendingRequestsFlags_;
+  std::vector<RangingRequest> robotsPendingRequests_;
+  std::vector<size_t> robotsNumberOfDroppedRequests_;
+  std::vector<RangingRequest> dispatchedRequests_;
+  bool areSlotsOutdated_;
+  size_t numberOfSlots_;
+  size_t currentSlot_;
+  std::shared_ptr<RTLSClock> clock_;
+  std::unique_ptr<RTLSTicker> ticker_;
+};
+
+}  // namespace core
+}  // namespace romea
+
+#endif  // ROMEA_CORE_RTLS__COORDINATION__RTLSCHANNELARBITER_HPP_
@@ -0,0 +1,70 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ROMEA_CORE_RTLS__COORDINATION__RTLSCLOCK_HPP_
+#define ROMEA_CORE_RTLS__COORDINATION__RTLSCLOCK_HPP_
+
+// std
+#include <functional>
+#include <memory>
+
+// romea
+#include "romea_core_common/time/Time.hpp"
+
+namespace romea
+{
+namespace core
+{
+
+class RTLSTicker
+{
+public:
+  virtual ~RTLSTicker() = default;
+
+  virtual void start() = 0;
+
+  virtual void stop() = 0;
+};
+
+// Time and periodic ticks source of coordination classes, it can be replaced
+// by a virtual clock to drive them from a discrete event loop
+class RTLSClock
+{
+public:
+  using TickCallback = std::function<void ()>;
+
+public:
+  virtual ~RTLSClock() = default;
+
+  virtual TimePoint now() const = 0;
+
+  virtual std::unique_ptr<RTLSTicker> createTicker(
+    TickCallback tickCallback,
+    const Duration & period) = 0;
+};
+
+class RTLSSystemClock : public RTLSClock
+{
+public:
+  TimePoint now() const override;
+
+  std::unique_ptr<RTLSTicker> createTicker(
+    TickCallback tickCallback,
+    const Duration & period) override;
+};
+
+}  // namespace core
+}  // namespace romea
+
+#endif  // ROMEA_CORE_RTLS__COORDINATION__RTLSCLOCK_HPP_
@@ -0,0 +1,63 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ROMEA_CORE_RTLS__COORDINATION__RTLSGDOPRESPONDERSSELECTOR_HPP_
+#define ROMEA_CORE_RTLS__COORDINATION__RTLSGDOPRESPONDERSSELECTOR_HPP_
+
+// Eigen
+#include <Eigen/Core>
+
+// std
+#include <vector>
+
+// romea
+#include "romea_core_common/containers/Eigen/VectorOfEigenVector.hpp"
+
+namespace romea
+{
+namespace core
+{
+
+class RTLSGDOPRespondersSelector
+{
+public:
+  explicit RTLSGDOPRespondersSelector(const VectorOfEigenVector3d & respondersPositions);
+
+  const std::vector<size_t> & select(
+    const Eigen::Vector3d & position,
+    const std::vector<size_t> & candidatesIndexes,
+    const size_t & numberOfSelectedResponders);
+
+  void setResponderPosition(const size_t & responderIndex, const Eigen::Vector3d & position);
+
+  double computeGDOP(
+    const Eigen::Vector3d & position,
+    const std::vector<size_t> & respondersIndexes) const;
+
+private:
+  Eigen::Vector2d computeLineOfSight_(
+    const Eigen::Vector3d & position,
+    const size_t & responderIndex) const;
+
+private:
+  VectorOfEigenVector3d respondersPositions_;
+  VectorOfEigenVector2d linesOfSight_;
+  std::vector<unsigned char> selectedFlags_;
+  std::vector<size_t> selectedIndexes_;
+};
+
+}  // namespace core
+}  // namespace romea
+
+#endif  // ROMEA_CORE_RTLS__COORDINATION__RTLSGDOPRESPONDERSSELECTOR_HPP_
@@ -20,6 +20,9 @@
 #include <Eigen/Core>
 
 // std
+#include <array>
+#include <atomic>
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -28,7 +31,10 @@
 // romea
 #include "romea_core_common/time/Time.hpp"
 #include "romea_core_common/containers/Eigen/VectorOfEigenVector.hpp"
+#include "romea_core_rtls/coordination/RTLSGDOPRespondersSelector.hpp"
+#include "romea_core_rtls/coordination/RTLSInformationGainPairSelector.hpp"
 #include "romea_core_rtls/coordination/RTLSReachableTransceivers.hpp"
+#include "romea_core_rtls/coordination/RTLSSeqLock.hpp"
 #include "romea_core_rtls/coordination/RTLSSimpleCoordinatorScheduler.hpp"
 
 
@@ -39,6 +45,9 @@ namespace core
 
 class RTLSGeoreferencedCoordinatorScheduler : public RTLSSimpleCoordinatorScheduler
 {
+public:
+  using UncertaintySource = std::function<Eigen::Matrix2d()>;
+
 public:
   RTLSGeoreferencedCoordinatorScheduler(
     const double & pollRate,
@@ -47,7 +56,9 @@ public:
     const VectorOfEigenVector3d & initiatorsPositions,
     const std::vector<std::string> & respondersNames,
     const VectorOfEigenVector3d & respondersPositions,
-    RangingRequestCallback rangingRequestCallback);
+    RangingRequestCallback rangingRequestCallback,
+    const PollingMode & pollingMode = PollingMode::TIMER,
+    std::shared_ptr<RTLSClock> clock = std::make_shared<RTLSSystemClock>());
 
   DiagnosticReport getReport() override;
 
@@ -55,20 +66,99 @@ public:
 
   void updateRobotPosition(const Eigen::Vector3d & robotPosition);
 
+  void setMaximalNumberOfSelectedResponders(const size_t & maximalNumberOfSelectedResponders);
+
+  void setResearchHysteresisDistance(const double & hysteresisDistance);
+
+  size_t addResponder(const std::string & responderName, const Eigen::Vector3d & position);
+
+  void removeResponder(const size_t & responderIndex);
+
+  void updateResponderPosition(const size_t & responderIndex, const Eigen::Vector3d & position);
+
+  // must be called before start, only used when superframe is enabled
+  void setNearRespondersPollWeight(const double & distance, const size_t & weight);
+
+  // must be called before start, next pair is then chosen to most reduce the trace of
+  // the position covariance given by source, superframe takes precedence when enabled
+  void enableInformationGainPolling(
+    UncertaintySource uncertaintySource,
+    const double & rangeStd,
+    const Duration & maximalLinkAge);
+
+  void disableInformationGainPolling();
+
 protected:
-  void timerCallback_() override;
+  void poll_() override;
 
   void incrementPollIndexes_() override;
 
   void selectResponders_();
 
+  void publishSelectedResponders_();
+
+  void applyRespondersUpdates_();
+
+  void buildSuperframe_() override;
+
+  void startSuperframe_() override;
+
+  void computeRespondersWeights_(std::vector<size_t> & respondersWeights);
+
+  void pollMostInformativePair_(const Eigen::Vector3d & robotPosition);
+
+  bool isRobotPositionAvailable_(Eigen::Vector3d & robotPosition) const;
+
+  std::shared_ptr<const std::vector<size_t>> loadSelectedResponders_() const;
+
 private:
-  std::mutex mutex_;
-  TimePoint lastRobotPositionStamp_;
-  Eigen::Vector3d lastRobotPosition_;
+  struct RobotPosition
+  {
+    std::array<double, 3> position;
+    TimePoint stamp;
+  };
+
+  enum class RespondersUpdateType
+  {
+    ADD,
+    REMOVE,
+    MOVE
+  };
+
+  struct RespondersUpdate
+  {
+    RespondersUpdateType type;
+    size_t responderIndex;
+    Eigen::Vector3d position;
+  };
+
+  RTLSSeqLock<RobotPosition> lastRobotPosition_;
   RTLSReachableTransceivers reachableResponders_;
+  std::atomic<double> researchHysteresisDistance_;
+  RTLSGDOPRespondersSelector gdopRespondersSelector_;
+  std::atomic<size_t> maximalNumberOfSelectedResponders_;
+
+  // responders changes are queued and applied by polling thread
+  std::mutex respondersUpdatesMutex_;
+  std::vector<RespondersUpdate> pendingRespondersUpdates_;
+  std::vector<RespondersUpdate> appliedRespondersUpdates_;
+  std::atomic<bool> hasPendingRespondersUpdates_;
+  std::vector<unsigned char> activeResponders_;
+
+  // only used by polling thread, readers get the published snapshot
   std::vector<size_t> selectedRespondersIndexes_;
   size_t selectedRespondersPollIndex_;
+  std::shared_ptr<const std::vector<size_t>> publishedSelectedRespondersIndexes_;
+
+  double nearRespondersDistance_;
+  size_t nearRespondersPollWeight_;
+  std::vector<size_t> superframeRespondersIndexes_;
+  std::vector<size_t> superframeRespondersWeights_;
+  std::vector<size_t> respondersWeights_;
+
+  UncertaintySource uncertaintySource_;
+  std::unique_ptr<RTLSInformationGainPairSelector> informationGainPairSelector_;
+  std::vector<size_t> informativeRespondersIndexes_;
 };
 
 }  // namespace core
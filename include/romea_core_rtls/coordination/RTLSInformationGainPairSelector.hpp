@@ -0,0 +1,91 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ROMEA_CORE_RTLS__COORDINATION__RTLSINFORMATIONGAINPAIRSELECTOR_HPP_
+#define ROMEA_CORE_RTLS__COORDINATION__RTLSINFORMATIONGAINPAIRSELECTOR_HPP_
+
+// Eigen
+#include <Eigen/Core>
+
+// std
+#include <functional>
+#include <vector>
+
+// romea
+#include "romea_core_common/time/Time.hpp"
+#include "romea_core_common/containers/Eigen/VectorOfEigenVector.hpp"
+
+namespace romea
+{
+namespace core
+{
+
+// Select (initiator, responder) pair whose range would most reduce position
+// covariance trace, links older than maximal age are polled first
+class RTLSInformationGainPairSelector
+{
+public:
+  using LinkFilter = std::function<bool (
+        const size_t & /*initiatorIndex*/,
+        const size_t & /*responderIndex*/)>;
+
+public:
+  RTLSInformationGainPairSelector(
+    const size_t & numberOfInitiators,
+    const VectorOfEigenVector3d & respondersPositions,
+    const double & rangeStd,
+    const Duration & maximalLinkAge);
+
+  void setResponderPosition(const size_t & responderIndex, const Eigen::Vector3d & position);
+
+  // expected effect of previous selections is applied to covariance until a new one is set
+  void setCovariance(const Eigen::Matrix2d & covariance);
+
+  const Eigen::Matrix2d & getCovariance() const;
+
+  bool select(
+    const Eigen::Vector3d & position,
+    const std::vector<size_t> & candidatesIndexes,
+    const TimePoint & stamp,
+    size_t & initiatorIndex,
+    size_t & responderIndex,
+    const LinkFilter & isLinkSelectable = nullptr);
+
+  double computeTraceReduction(
+    const Eigen::Vector3d & position,
+    const size_t & responderIndex) const;
+
+private:
+  Eigen::Vector2d computeLineOfSight_(
+    const Eigen::Vector3d & position,
+    const size_t & responderIndex) const;
+
+  TimePoint & lastSelectionStamp_(const size_t & initiatorIndex, const size_t & responderIndex);
+
+  void update_(const Eigen::Vector2d & lineOfSight);
+
+private:
+  size_t numberOfInitiators_;
+  VectorOfEigenVector3d respondersPositions_;
+  double rangeVariance_;
+  Duration maximalLinkAge_;
+  Eigen::Matrix2d sourceCovariance_;
+  Eigen::Matrix2d covariance_;
+  std::vector<TimePoint> lastSelectionStamps_;
+};
+
+}  // namespace core
+}  // namespace romea
+
+#endif  // ROMEA_CORE_RTLS__COORDINATION__RTLSINFORMATIONGAINPAIRSELECTOR_HPP_
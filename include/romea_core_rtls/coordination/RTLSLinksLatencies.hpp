@@ -0,0 +1,96 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ROMEA_CORE_RTLS__COORDINATION__RTLSLINKSLATENCIES_HPP_
+#define ROMEA_CORE_RTLS__COORDINATION__RTLSLINKSLATENCIES_HPP_
+
+// std
+#include <mutex>
+#include <vector>
+
+// romea
+#include "romea_core_common/time/Time.hpp"
+
+namespace romea
+{
+namespace core
+{
+
+// Streaming estimation of a high quantile of the exchange latency of each
+// (initiator, responder) link, used to bound requests timeouts
+class RTLSLinksLatencies
+{
+public:
+  RTLSLinksLatencies(
+    const size_t & numberOfInitiators,
+    const size_t & numberOfResponders,
+    const double & quantile,
+    const double & timeoutMargin,
+    const Duration & minimalTimeout);
+
+  void request(
+    const size_t & initiatorIndex,
+    const size_t & responderIndex,
+    const TimePoint & stamp);
+
+  // feedback of a request sent before the last one of its link is stale and ignored
+  void feedback(
+    const size_t & initiatorIndex,
+    const size_t & responderIndex,
+    const TimePoint & stamp,
+    const bool & isSuccessful,
+    const TimePoint & requestStamp = TimePoint::max());
+
+  void update(
+    const size_t & initiatorIndex,
+    const size_t & responderIndex,
+    const double & latency);
+
+  double getLatencyQuantile(const size_t & initiatorIndex, const size_t & responderIndex);
+
+  Duration computeTimeout(
+    const size_t & initiatorIndex,
+    const size_t & responderIndex,
+    const Duration & maximalTimeout);
+
+  void addResponder();
+
+private:
+  struct Link
+  {
+    TimePoint requestStamp;
+    bool isRequestPending;
+    double quantile;
+    double scale;
+    size_t numberOfSamples;
+  };
+
+  Link & link_(const size_t & initiatorIndex, const size_t & responderIndex);
+
+  void update_(Link & link, const double & latency);
+
+private:
+  std::mutex mutex_;
+  size_t numberOfInitiators_;
+  size_t numberOfResponders_;
+  double quantile_;
+  double timeoutMargin_;
+  Duration minimalTimeout_;
+  std::vector<Link> links_;
+};
+
+}  // namespace core
+}  // namespace romea
+
+#endif  // ROMEA_CORE_RTLS__COORDINATION__RTLSLINKSLATENCIES_HPP_
@@ -0,0 +1,90 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ROMEA_CORE_RTLS__COORDINATION__RTLSPIPELINEDCOORDINATORSCHEDULER_HPP_
+#define ROMEA_CORE_RTLS__COORDINATION__RTLSPIPELINEDCOORDINATORSCHEDULER_HPP_
+
+// std
+#include <string>
+#include <vector>
+
+// romea
+#include "romea_core_rtls/coordination/RTLSSimpleCoordinatorScheduler.hpp"
+
+
+namespace romea
+{
+namespace core
+{
+
+class RTLSPipelinedCoordinatorScheduler : public RTLSSimpleCoordinatorScheduler
+{
+public:
+  RTLSPipelinedCoordinatorScheduler(
+    const double & pollRate,
+    const std::vector<std::string> & initiatorsNames,
+    const std::vector<std::string> & respondersNames,
+    RangingRequestCallback rangingRequestCallback,
+    std::shared_ptr<RTLSClock> clock = std::make_shared<RTLSSystemClock>());
+
+  void dispatch(
+    const size_t & initiatorIndex,
+    const size_t & responderIndex,
+    const Duration & timeout) override;
+
+  size_t getNumberOfInFlightRequests();
+
+protected:
+  void timerCallback_() override;
+
+  void poll_() override;
+
+  bool completeRequest_(
+    const size_t & initiatorIndex,
+    const size_t & responderIndex,
+    const TimePoint & requestStamp) override;
+
+  void pollFreeResponders_(const TimePoint & stamp);
+
+  // returns true when the end of superframe has been reached
+  bool pollSuperframeSlots_();
+
+  void addInFlightRequest_(
+    const size_t & initiatorIndex,
+    const size_t & responderIndex,
+    const TimePoint & stamp);
+
+  void release_(const size_t & inFlightRequestIndex);
+
+private:
+  struct InFlightRequest
+  {
+    size_t initiatorIndex;
+    size_t responderIndex;
+    TimePoint stamp;
+    Duration timeout;
+    TimePoint deadline;
+  };
+
+  std::vector<unsigned char> busyInitiators_;
+  std::vector<unsigned char> busyResponders_;
+  std::vector<size_t> initiatorsRespondersPollIndexes_;
+  std::vector<InFlightRequest> inFlightRequests_;
+  std::vector<InFlightRequest> dispatchedRequests_;
+};
+
+}  // namespace core
+}  // namespace romea
+
+#endif   // ROMEA_CORE_RTLS__COORDINATION__RTLSPIPELINEDCOORDINATORSCHEDULER_HPP_
@@ -0,0 +1,83 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ROMEA_CORE_RTLS__COORDINATION__RTLSPROBINGBACKOFF_HPP_
+#define ROMEA_CORE_RTLS__COORDINATION__RTLSPROBINGBACKOFF_HPP_
+
+// std
+#include <vector>
+
+// romea
+#include "romea_core_common/time/Time.hpp"
+
+namespace romea
+{
+namespace core
+{
+
+// Entities (responders, links) that keep failing while being unreliable are excluded
+// from polling and only probed with an exponential backoff until they answer. It is
+// not thread safe, owners are expected to lock it
+class RTLSProbingBackoff
+{
+public:
+  RTLSProbingBackoff(
+    const size_t & numberOfEntities,
+    const Duration & minimalProbePeriod,
+    const Duration & maximalProbePeriod);
+
+  // return true when entity is not excluded or when its probe is due
+  bool canPoll(const size_t & entityIndex, const TimePoint & stamp) const;
+
+  // must be called only when a request is actually issued for entity, probe answer may
+  // be lost without any feedback so next probe is scheduled as if it failed
+  void commitProbe(const size_t & entityIndex, const TimePoint & stamp);
+
+  void feedback(
+    const size_t & entityIndex,
+    const TimePoint & stamp,
+    const bool & isSuccessful,
+    const bool & isReliable);
+
+  bool isExcluded(const size_t & entityIndex) const;
+
+  const Duration & getProbePeriod(const size_t & entityIndex) const;
+
+  size_t getNumberOfExcludedEntities() const;
+
+  size_t getNumberOfProbes() const;
+
+  void addEntities(const size_t & numberOfEntities);
+
+private:
+  struct Entity
+  {
+    bool isExcluded;
+    size_t numberOfConsecutiveFailures;
+    Duration probePeriod;
+    TimePoint nextProbeStamp;
+  };
+
+private:
+  Duration minimalProbePeriod_;
+  Duration maximalProbePeriod_;
+  std::vector<Entity> entities_;
+  size_t numberOfExcludedEntities_;
+  size_t numberOfProbes_;
+};
+
+}  // namespace core
+}  // namespace romea
+
+#endif  // ROMEA_CORE_RTLS__COORDINATION__RTLSPROBINGBACKOFF_HPP_
@@ -0,0 +1,95 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ROMEA_CORE_RTLS__COORDINATION__RTLSRANGEAGGREGATOR_HPP_
+#define ROMEA_CORE_RTLS__COORDINATION__RTLSRANGEAGGREGATOR_HPP_
+
+// std
+#include <functional>
+#include <optional>
+#include <vector>
+
+// romea
+#include "romea_core_common/time/Time.hpp"
+#include "romea_core_rtls_transceiver/RTLSTransceiverRangingResult.hpp"
+
+namespace romea
+{
+namespace core
+{
+
+class RTLSRangeAggregator
+{
+public:
+  using RangeVector = std::vector<std::optional<double>>;
+  using RangeArray = std::vector<RangeVector>;
+  using RangesCallback = std::function<void (const RangeArray & /*ranges*/)>;
+
+public:
+  RTLSRangeAggregator(
+    const size_t & numberOfInitiators,
+    const size_t & numberOfResponders,
+    const Duration & maximalRangeAge,
+    const Duration & window,
+    const size_t & minimalNumberOfNewRangesPerInitiator,
+    RangesCallback rangesCallback);
+
+  void update(
+    const size_t & initiatorIndex,
+    const size_t & responderIndex,
+    const RTLSTransceiverRangingResult & result);
+
+  void update(
+    const size_t & initiatorIndex,
+    const size_t & responderIndex,
+    const RTLSTransceiverRangingResult & result,
+    const TimePoint & stamp);
+
+  // Emits pending ranges once the window has elapsed even when no feedback comes,
+  // it is expected to be called periodically (e.g. on scheduler ticks)
+  void poll();
+
+  void poll(const TimePoint & stamp);
+
+  const RangeArray & getRanges(const TimePoint & stamp);
+
+  void reset();
+
+private:
+  bool isCoverageReached_() const;
+
+  bool isWindowElapsed_(const TimePoint & stamp);
+
+  void emit_(const TimePoint & stamp);
+
+private:
+  size_t numberOfInitiators_;
+  size_t numberOfResponders_;
+  Duration maximalRangeAge_;
+  Duration window_;
+  size_t minimalNumberOfNewRangesPerInitiator_;
+  RangesCallback rangesCallback_;
+
+  std::vector<double> lastRanges_;
+  std::vector<TimePoint> lastRangesStamps_;
+  std::vector<unsigned char> newRangesFlags_;
+  std::vector<size_t> numbersOfNewRanges_;
+  std::optional<TimePoint> lastEmissionStamp_;
+  RangeArray ranges_;
+};
+
+}  // namespace core
+}  // namespace romea
+
+#endif  // ROMEA_CORE_RTLS__COORDINATION__RTLSRANGEAGGREGATOR_HPP_
@@ -0,0 +1,118 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ROMEA_CORE_RTLS__COORDINATION__RTLSRANGESTATISTICS_HPP_
+#define ROMEA_CORE_RTLS__COORDINATION__RTLSRANGESTATISTICS_HPP_
+
+// std
+#include <vector>
+
+// romea
+#include "romea_core_common/time/Time.hpp"
+#include "romea_core_rtls/coordination/RTLSStreamingQuantile.hpp"
+
+namespace romea
+{
+namespace core
+{
+
+struct RTLSLinkRangeStatistics
+{
+  size_t numberOfRanges;
+  size_t numberOfJumps;
+  double lastRange;
+  double innovationMean;
+  double innovationStd;
+  double medianAbsoluteInnovation;
+  double highAbsoluteInnovation;
+  double rangeStd;
+  double weight;
+};
+
+// Streaming statistics of ranges measured on each (initiator, responder) link in
+// constant memory. Innovations, i.e. differences between each range and its linear
+// extrapolation from the two previous ranges of the link, remove the tag motion and are
+// scaled so that their variance is twice the range noise variance. A range measured too
+// long after the previous one restarts the extrapolation. Innovations mean and variance
+// are exponentially weighted so that a link recovering from a noisy period regains its
+// weight. Range weights are relative to nominal range variance and never exceed one
+class RTLSRangeStatistics
+{
+public:
+  static constexpr double HIGH_QUANTILE_PROBABILITY = 0.95;
+
+public:
+  RTLSRangeStatistics(
+    const size_t & numberOfInitiators,
+    const size_t & numberOfResponders,
+    const double & nominalRangeStd,
+    const double & jumpThreshold);
+
+  void update(
+    const size_t & initiatorIndex,
+    const size_t & responderIndex,
+    const double & range,
+    const TimePoint & stamp);
+
+  RTLSLinkRangeStatistics get(const size_t & initiatorIndex, const size_t & responderIndex) const;
+
+  double getRangeStd(const size_t & initiatorIndex, const size_t & responderIndex) const;
+
+  double getRangeWeight(const size_t & initiatorIndex, const size_t & responderIndex) const;
+
+  // weights of ranges measured by an initiator indexed by responder
+  void getRangesWeights(const size_t & initiatorIndex, std::vector<double> & weights) const;
+
+  const double & getNominalRangeStd() const;
+
+  const double & getJumpThreshold() const;
+
+  size_t addResponder();
+
+private:
+  struct Link
+  {
+    size_t numberOfRanges;
+    size_t numberOfConsecutiveRanges;
+    size_t numberOfInnovations;
+    size_t numberOfJumps;
+    double lastRange;
+    TimePoint lastStamp;
+    double previousRange;
+    TimePoint previousStamp;
+    double innovationMean;
+    double innovationVariance;
+    RTLSStreamingQuantile medianAbsoluteInnovation;
+    RTLSStreamingQuantile highAbsoluteInnovation;
+  };
+
+  Link makeLink_() const;
+
+  size_t linkIndex_(const size_t & initiatorIndex, const size_t & responderIndex) const;
+
+  double computeInnovationVariance_(const Link & link) const;
+
+  double computeRangeStd_(const Link & link) const;
+
+private:
+  size_t numberOfInitiators_;
+  double nominalRangeStd_;
+  double jumpThreshold_;
+  std::vector<Link> links_;
+};
+
+}  // namespace core
+}  // namespace romea
+
+#endif  // ROMEA_CORE_RTLS__COORDINATION__RTLSRANGESTATISTICS_HPP_
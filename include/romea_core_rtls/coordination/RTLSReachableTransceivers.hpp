@@ -16,11 +16,14 @@
 #ifndef ROMEA_CORE_RTLS__COORDINATION__RTLSREACHABLETRANSCEIVERS_HPP_
 #define ROMEA_CORE_RTLS__COORDINATION__RTLSREACHABLETRANSCEIVERS_HPP_
 
+// Eigen
+#include <Eigen/Core>
+
 // std
 #include <vector>
 
 // romea
-#include "romea_core_common/pointset/KdTree.hpp"
+#include "romea_core_common/containers/Eigen/VectorOfEigenVector.hpp"
 
 namespace romea
 {
@@ -32,16 +35,57 @@ class RTLSReachableTransceivers
 public:
   RTLSReachableTransceivers(
     const VectorOfEigenVector3d & points,
-    const double & researchRadius);
+    const double & researchRadius,
+    const double & hysteresisDistance = 0);
 
   const std::vector<size_t> & find(const Eigen::Vector3d & position);
 
+  void setHysteresisDistance(const double & hysteresisDistance);
+
+  size_t add(const Eigen::Vector3d & point);
+
+  void remove(const size_t & index);
+
+  void update(const size_t & index, const Eigen::Vector3d & point);
+
+  const Eigen::Vector3d & getPoint(const size_t & index) const;
+
+  size_t getNumberOfResearches() const;
+
 private:
-  double squaredResearchRadius_;
+  void buildGrid_();
+
+  size_t cellIndex_(const Eigen::Vector3d & point) const;
+
+  void insertInCell_(const size_t & index);
+
+  void removeFromCell_(const size_t & index);
+
+  void research_(
+    const Eigen::Vector3d & position,
+    const double & researchRadius,
+    std::vector<size_t> & researchIndexes);
+
+private:
+  double researchRadius_;
+  double hysteresisDistance_;
   VectorOfEigenVector3d points_;
-  KdTree<Eigen::Vector3d> kdTree_;
+  std::vector<unsigned char> activePoints_;
+
+  // points indexes are bucketed in a uniform xy grid built from initial points,
+  // points added later outside of its extent are kept in an extra bucket
+  Eigen::Vector2d gridOrigin_;
+  double cellSize_;
+  size_t numberOfColumns_;
+  size_t numberOfRows_;
+  std::vector<std::vector<size_t>> cells_;
+  std::vector<size_t> outsidePointsIndexes_;
+
+  bool isResearchCached_;
+  Eigen::Vector3d lastResearchPosition_;
+  size_t numberOfResearches_;
+  std::vector<size_t> candidateIndexes_;
   std::vector<size_t> neighborIndexes_;
-  std::vector<double> neighborSquareDistances_;
 };
 
 }   // namespace core
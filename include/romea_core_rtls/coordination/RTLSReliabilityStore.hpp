@@ -0,0 +1,94 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ROMEA_CORE_RTLS__COORDINATION__RTLSRELIABILITYSTORE_HPP_
+#define ROMEA_CORE_RTLS__COORDINATION__RTLSRELIABILITYSTORE_HPP_
+
+// std
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+// romea
+#include "romea_core_common/diagnostic/DiagnosticReport.hpp"
+
+namespace romea
+{
+namespace core
+{
+
+struct RTLSTransceiverReliability
+{
+  double reliability;
+  size_t numberOfSamples;
+  DiagnosticStatus status;
+};
+
+// Sliding window reliabilities of a set of transceivers stored in flat arrays.
+// Scores are counted in thirds of success (0 to 3) so that running sums are exact.
+// A single writer updates the store while readers go through atomics only
+class RTLSReliabilityStore
+{
+public:
+  static constexpr uint8_t MAXIMAL_SCORE = 3;
+
+public:
+  RTLSReliabilityStore(
+    const size_t & numberOfTransceivers,
+    const size_t & windowSize,
+    const double & lowThreshold,
+    const double & highThreshold);
+
+  RTLSReliabilityStore(const RTLSReliabilityStore & store, const size_t & capacity);
+
+  void update(const size_t & transceiverIndex, const uint8_t & score);
+
+  double getReliability(const size_t & transceiverIndex) const;
+
+  size_t getNumberOfSamples(const size_t & transceiverIndex) const;
+
+  DiagnosticStatus getStatus(const size_t & transceiverIndex) const;
+
+  // reliability, number of samples and status taken from the same update
+  RTLSTransceiverReliability load(const size_t & transceiverIndex) const;
+
+  size_t size() const;
+
+  size_t capacity() const;
+
+  size_t add();
+
+private:
+  uint8_t evaluate_(const uint32_t & sum, const uint32_t & numberOfSamples) const;
+
+private:
+  size_t capacity_;
+  size_t windowSize_;
+  double lowThreshold_;
+  double highThreshold_;
+  std::atomic<size_t> size_;
+
+  // written by updating thread only
+  std::vector<uint8_t> windows_;
+  std::vector<uint32_t> windowsPositions_;
+
+  // number of samples in high word and sum of scores in low word
+  std::vector<std::atomic<uint64_t>> tallies_;
+  std::vector<std::atomic<uint8_t>> statuses_;
+};
+
+}  // namespace core
+}  // namespace romea
+
+#endif  // ROMEA_CORE_RTLS__COORDINATION__RTLSRELIABILITYSTORE_HPP_
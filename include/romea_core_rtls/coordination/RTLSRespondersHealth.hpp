@@ -0,0 +1,68 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ROMEA_CORE_RTLS__COORDINATION__RTLSRESPONDERSHEALTH_HPP_
+#define ROMEA_CORE_RTLS__COORDINATION__RTLSRESPONDERSHEALTH_HPP_
+
+// std
+#include <mutex>
+
+// romea
+#include "romea_core_common/time/Time.hpp"
+#include "romea_core_rtls/coordination/RTLSProbingBackoff.hpp"
+
+namespace romea
+{
+namespace core
+{
+
+// Responders whose reliability falls below diagnostic low threshold are left out
+// of polling rotation and only probed with an exponential backoff until they answer
+class RTLSRespondersHealth
+{
+public:
+  RTLSRespondersHealth(
+    const size_t & numberOfResponders,
+    const Duration & minimalProbePeriod,
+    const Duration & maximalProbePeriod);
+
+  // side effect free, see RTLSProbingBackoff
+  bool canPoll(const size_t & responderIndex, const TimePoint & stamp);
+
+  // must be called only when responder is actually requested
+  void commitProbe(const size_t & responderIndex, const TimePoint & stamp);
+
+  void feedback(
+    const size_t & responderIndex,
+    const TimePoint & stamp,
+    const bool & isSuccessful,
+    const bool & isReliable);
+
+  bool isHealthy(const size_t & responderIndex);
+
+  Duration getProbePeriod(const size_t & responderIndex);
+
+  size_t getNumberOfProbes();
+
+  void addResponder();
+
+private:
+  std::mutex mutex_;
+  RTLSProbingBackoff backoff_;
+};
+
+}  // namespace core
+}  // namespace romea
+
+#endif  // ROMEA_CORE_RTLS__COORDINATION__RTLSRESPONDERSHEALTH_HPP_
@@ -0,0 +1,96 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ROMEA_CORE_RTLS__COORDINATION__RTLSSEQLOCK_HPP_
+#define ROMEA_CORE_RTLS__COORDINATION__RTLSSEQLOCK_HPP_
+
+// std
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace romea
+{
+namespace core
+{
+
+// Sequence lock: readers never block writers and retry when a write
+// happened while they were copying the value
+template<typename T>
+class RTLSSeqLock
+{
+  static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+
+public:
+  RTLSSeqLock()
+  : sequence_(0),
+    words_()
+  {
+    store(T());
+  }
+
+  void store(const T & value)
+  {
+    std::array<uint64_t, NUMBER_OF_WORDS> words{};
+    std::memcpy(words.data(), &value, sizeof(T));
+
+    // odd sequence means a write is in progress, it also excludes concurrent writers
+    uint32_t sequence = sequence_.load(std::memory_order_relaxed);
+    do {
+      while (sequence & 1) {
+        sequence = sequence_.load(std::memory_order_relaxed);
+      }
+    } while (!sequence_.compare_exchange_weak(sequence, sequence + 1, std::memory_order_acquire));
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (size_t n = 0; n < NUMBER_OF_WORDS; ++n) {
+      words_[n].store(words[n], std::memory_order_relaxed);
+    }
+
+    sequence_.store(sequence + 2, std::memory_order_release);
+  }
+
+  T load() const
+  {
+    std::array<uint64_t, NUMBER_OF_WORDS> words;
+    uint32_t sequence;
+    do {
+      do {
+        sequence = sequence_.load(std::memory_order_acquire);
+      } while (sequence & 1);
+
+      for (size_t n = 0; n < NUMBER_OF_WORDS; ++n) {
+        words[n] = words_[n].load(std::memory_order_relaxed);
+      }
+      std::atomic_thread_fence(std::memory_order_acquire);
+    } while (sequence_.load(std::memory_order_relaxed) != sequence);
+
+    T value;
+    std::memcpy(static_cast<void *>(&value), words.data(), sizeof(T));
+    return value;
+  }
+
+private:
+  static constexpr size_t NUMBER_OF_WORDS = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+  std::atomic<uint32_t> sequence_;
+  std::array<std::atomic<uint64_t>, NUMBER_OF_WORDS> words_;
+};
+
+}  // namespace core
+}  // namespace romea
+
+#endif  // ROMEA_CORE_RTLS__COORDINATION__RTLSSEQLOCK_HPP_
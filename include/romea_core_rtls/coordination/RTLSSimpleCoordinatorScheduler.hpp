@@ -17,13 +17,19 @@
 #define ROMEA_CORE_RTLS__COORDINATION__RTLSSIMPLECOORDINATORSCHEDULER_HPP_
 
 // std
+#include <memory>
 #include <string>
 #include <vector>
+#include <mutex>
 #include <functional>
 
 // romea
-#include "romea_core_common/time/Timer.hpp"
 #include "romea_core_rtls_transceiver/RTLSTransceiverRangingResult.hpp"
+#include "romea_core_rtls/coordination/RTLSClock.hpp"
+#include "romea_core_rtls/coordination/RTLSLinksHealth.hpp"
+#include "romea_core_rtls/coordination/RTLSLinksLatencies.hpp"
+#include "romea_core_rtls/coordination/RTLSRespondersHealth.hpp"
+#include "romea_core_rtls/coordination/RTLSSuperframe.hpp"
 #include "romea_core_rtls/coordination/RTLSTransceiversDiagnostics.hpp"
 
 
@@ -41,12 +47,20 @@ public:
         const size_t & /*responderIndex*/,
         const Duration & /*timeout*/)>;
 
+  enum class PollingMode
+  {
+    TIMER,
+    COMPLETION
+  };
+
 public:
   RTLSSimpleCoordinatorScheduler(
     const double & poll_rate,
     const std::vector<std::string> & initiatorsNames,
     const std::vector<std::string> & respondersNames,
-    RangingRequestCallback rangingCallback);
+    RangingRequestCallback rangingCallback,
+    const PollingMode & pollingMode = PollingMode::TIMER,
+    std::shared_ptr<RTLSClock> clock = std::make_shared<RTLSSystemClock>());
 
   virtual ~RTLSSimpleCoordinatorScheduler() = default;
 
@@ -59,13 +73,103 @@ public:
     const size_t & responderIndex,
     const RangingResult & result);
 
+  // requestStamp is the time at which transceivers received the ranging request, feedback
+  // of a request older than the one in progress for the same pair is stale and ignored
+  void feedback(
+    const size_t & initiatorIndex,
+    const size_t & responderIndex,
+    const RangingResult & result,
+    const TimePoint & requestStamp);
+
+  // to be called when a request delayed by a channel arbiter is actually sent, latency
+  // and completion timeout are then measured from dispatch with the timeout given to robot
+  virtual void dispatch(
+    const size_t & initiatorIndex,
+    const size_t & responderIndex,
+    const Duration & timeout);
+
   virtual DiagnosticReport getReport();
 
+  // numeric reliabilities for consumers that do not need diagnostic messages
+  void getInitiatorsReliabilities(std::vector<RTLSTransceiverReliability> & reliabilities) const;
+  void getRespondersReliabilities(std::vector<RTLSTransceiverReliability> & reliabilities) const;
+
+  // must be called before start
+  void enableSuperframe();
+
+  void disableSuperframe();
+
+  const RTLSSuperframe & getSuperframe() const;
+
+  // must be called before start
+  void enableAdaptiveTimeouts(
+    const double & latencyQuantile = 0.95,
+    const double & timeoutMargin = 1.5,
+    const Duration & minimalTimeout = durationFromMilliSecond(2));
+
+  void disableAdaptiveTimeouts();
+
+  Duration getTimeout(const size_t & initiatorIndex, const size_t & responderIndex);
+
+  // must be called before start
+  void enableHealthAwareRotation(
+    const Duration & minimalProbePeriod = durationFromMilliSecond(500),
+    const Duration & maximalProbePeriod = durationFromSecond(8));
+
+  void disableHealthAwareRotation();
+
+  bool isResponderHealthy(const size_t & responderIndex);
+
+  // must be called before start
+  void enableLinksPruning(
+    const double & minimalLinkQuality = 0.3,
+    const Duration & minimalProbePeriod = durationFromMilliSecond(500),
+    const Duration & maximalProbePeriod = durationFromSecond(8));
+
+  void disableLinksPruning();
+
+  bool isLinkPruned(const size_t & initiatorIndex, const size_t & responderIndex);
+
+  double getLinkQuality(const size_t & initiatorIndex, const size_t & responderIndex) const;
+
+  RTLSLinkRangeStatistics getLinkRangeStatistics(
+    const size_t & initiatorIndex,
+    const size_t & responderIndex) const;
+
+  // weights of ranges measured by an initiator to be given to position estimators
+  void getRangesWeights(const size_t & initiatorIndex, std::vector<double> & weights) const;
+
 protected:
   virtual void timerCallback_();
 
+  virtual void poll_();
+
   virtual void incrementPollIndexes_();
 
+  void request_(const size_t & initiatorIndex, const size_t & responderIndex);
+
+  // side effect free, probes of unhealthy responders or pruned links are only
+  // committed when the pair is actually requested
+  bool canPoll_(const size_t & initiatorIndex, const size_t & responderIndex);
+
+  void commitProbes_(
+    const size_t & initiatorIndex,
+    const size_t & responderIndex,
+    const TimePoint & stamp);
+
+  virtual bool completeRequest_(
+    const size_t & initiatorIndex,
+    const size_t & responderIndex,
+    const TimePoint & requestStamp);
+
+  void pollNext_();
+
+  void pollSuperframe_();
+
+  virtual void buildSuperframe_();
+
+  virtual void startSuperframe_();
+
 protected:
   size_t numberOfInitiators_;
   size_t initiatorsPollIndex_;
@@ -73,11 +177,30 @@ protected:
   size_t numberOfResponders_;
   size_t respondersPollIndex_;
 
-  Timer timer_;
+  Duration pollPeriod_;
+  std::shared_ptr<RTLSClock> clock_;
+  std::unique_ptr<RTLSTicker> ticker_;
   Duration timeout_;
+  std::unique_ptr<RTLSLinksLatencies> linksLatencies_;
+  std::unique_ptr<RTLSRespondersHealth> respondersHealth_;
+  std::unique_ptr<RTLSLinksHealth> linksHealth_;
   RangingRequestCallback rangingRequestCallback_;
 
   RTLSTransceiversDiagnostics diagnostics_;
+
+  bool isSuperframeEnabled_;
+  RTLSSuperframe superframe_;
+
+  PollingMode pollingMode_;
+  std::mutex pollMutex_;
+  bool isRunning_;
+  bool isPolling_;
+  bool isPollRequested_;
+  bool isRequestPending_;
+  size_t pendingInitiatorIndex_;
+  size_t pendingResponderIndex_;
+  Duration pendingTimeout_;
+  TimePoint lastRequestStamp_;
 };
 
 }  // namespace core
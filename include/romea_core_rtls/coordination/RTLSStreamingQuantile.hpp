@@ -0,0 +1,60 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ROMEA_CORE_RTLS__COORDINATION__RTLSSTREAMINGQUANTILE_HPP_
+#define ROMEA_CORE_RTLS__COORDINATION__RTLSSTREAMINGQUANTILE_HPP_
+
+// std
+#include <array>
+#include <cstddef>
+
+namespace romea
+{
+namespace core
+{
+
+// P-square estimate of a quantile (Jain and Chlamtac) in constant memory,
+// five markers are moved along the samples instead of storing them
+class RTLSStreamingQuantile
+{
+public:
+  explicit RTLSStreamingQuantile(const double & probability);
+
+  void update(const double & sample);
+
+  double get() const;
+
+  const double & getProbability() const;
+
+  size_t getNumberOfSamples() const;
+
+private:
+  double computeParabolicHeight_(const size_t & i, const double & direction) const;
+
+  double computeLinearHeight_(const size_t & i, const double & direction) const;
+
+private:
+  static constexpr size_t NUMBER_OF_MARKERS = 5;
+
+  double probability_;
+  size_t numberOfSamples_;
+  std::array<double, NUMBER_OF_MARKERS> heights_;
+  std::array<double, NUMBER_OF_MARKERS> positions_;
+  std::array<double, NUMBER_OF_MARKERS> desiredPositions_;
+};
+
+}  // namespace core
+}  // namespace romea
+
+#endif  // ROMEA_CORE_RTLS__COORDINATION__RTLSSTREAMINGQUANTILE_HPP_
@@ -0,0 +1,69 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ROMEA_CORE_RTLS__COORDINATION__RTLSSUPERFRAME_HPP_
+#define ROMEA_CORE_RTLS__COORDINATION__RTLSSUPERFRAME_HPP_
+
+// std
+#include <cstddef>
+#include <vector>
+
+namespace romea
+{
+namespace core
+{
+
+// Poll order of a whole cycle compiled in a flat table, each scheduler tick
+// reads the next slot. Timeouts are not stored in slots because adaptive ones
+// change within a frame, they are computed when slots are requested
+class RTLSSuperframe
+{
+public:
+  struct Slot
+  {
+    size_t initiatorIndex;
+    size_t responderIndex;
+  };
+
+public:
+  RTLSSuperframe();
+
+  void build(
+    const size_t & numberOfInitiators,
+    const std::vector<size_t> & respondersIndexes,
+    const std::vector<size_t> & respondersWeights);
+
+  void clear();
+
+  bool empty() const;
+
+  size_t size() const;
+
+  const Slot & operator[](const size_t & slotIndex) const;
+
+  bool isAtFrameStart() const;
+
+  const Slot & next();
+
+private:
+  std::vector<Slot> slots_;
+  std::vector<size_t> respondersSequence_;
+  std::vector<long> respondersCredits_;
+  size_t slotIndex_;
+};
+
+}  // namespace core
+}  // namespace romea
+
+#endif  // ROMEA_CORE_RTLS__COORDINATION__RTLSSUPERFRAME_HPP_
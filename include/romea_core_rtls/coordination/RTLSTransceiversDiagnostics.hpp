@@ -15,23 +15,30 @@
 #ifndef ROMEA_CORE_RTLS__COORDINATION__RTLSTRANSCEIVERSDIAGNOSTICS_HPP_
 #define ROMEA_CORE_RTLS__COORDINATION__RTLSTRANSCEIVERSDIAGNOSTICS_HPP_
 
+// Eigen
+#include <Eigen/Core>
+
 // std
 #include <atomic>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <string>
 
 // romea
-#include "romea_core_common/monitoring/OnlineAverage.hpp"
-#include "romea_core_common/monitoring/RateMonitoring.hpp"
 #include "romea_core_common/diagnostic/CheckupReliability.hpp"
 #include "romea_core_rtls_transceiver/RTLSTransceiverRangingResult.hpp"
+#include "romea_core_rtls/coordination/RTLSRangeStatistics.hpp"
+#include "romea_core_rtls/coordination/RTLSReliabilityStore.hpp"
 
 namespace romea
 {
 namespace core
 {
 
+// Reliabilities are updated in flat stores without touching diagnostic reports,
+// which are only rendered again when transceiver status or reliability bucket
+// has changed since they were last requested
 class RTLSTransceiversDiagnostics
 {
 public:
@@ -43,33 +50,74 @@ public:
   void update(
     const size_t & initiatorsPollIndex,
     const size_t & respondersPollIndex,
-    const RTLSTransceiverRangingResult & rangingResult);
+    const RTLSTransceiverRangingResult & rangingResult,
+    const TimePoint & stamp);
 
   DiagnosticReport getInitiatorReport(const size_t & initiatorIndex) const;
   DiagnosticReport getResponderReport(const size_t & responderIndex) const;
 
+  // reports of all initiators followed by those of all or given responders
+  DiagnosticReport getReport() const;
+  DiagnosticReport getReport(const std::vector<size_t> & respondersIndexes) const;
+
+  // numeric snapshots without any string formatting
+  void getInitiatorsReliabilities(std::vector<RTLSTransceiverReliability> & reliabilities) const;
+  void getRespondersReliabilities(std::vector<RTLSTransceiverReliability> & reliabilities) const;
+
+  size_t getNumberOfRenderedReports() const;
+
+  // exponentially smoothed success ratio of each (initiator, responder) link,
+  // links never polled are assumed to be fine
+  double getLinkQuality(const size_t & initiatorIndex, const size_t & responderIndex) const;
+  Eigen::MatrixXd getLinksQualities() const;
+  double getResponderBestLinkQuality(const size_t & responderIndex) const;
+
+  // streaming statistics of ranges measured on each link, noisy links get lower weights
+  RTLSLinkRangeStatistics getLinkRangeStatistics(
+    const size_t & initiatorIndex,
+    const size_t & responderIndex) const;
+  void getRangesWeights(const size_t & initiatorIndex, std::vector<double> & weights) const;
+
+  bool isResponderReliable(const size_t & responderIndex) const;
+
+  size_t addResponder(const std::string & responderName);
+
 private:
-  void initInitiatorsDiagnostics_(
-    const double & pollRate,
-    const std::vector<std::string> & initiatorsNames);
+  struct CachedReport
+  {
+    std::unique_ptr<CheckupReliability> diagnostic;
+    DiagnosticReport report;
+    uint32_t key;
+  };
 
-  void initRespondersDiagnostics_(
-    const double & pollRate,
-    const std::vector<std::string> & respondersNames);
+  static std::vector<CachedReport> makeCachedReports_(
+    const std::vector<std::string> & transceiversNames);
+
+  static CachedReport makeCachedReport_(const std::string & transceiverName);
 
-  void updateInitiatorReliability_(
-    const double & reliability,
-    const size_t & initiatorIndex);
+  bool refreshReport_(
+    CachedReport & cachedReport,
+    const RTLSReliabilityStore & reliabilities,
+    const size_t & transceiverIndex) const;
 
-  void updateResponderReliability_(
-    const double & reliability,
-    const size_t & responderIndex);
+  DiagnosticReport getReport_(const std::vector<size_t> & respondersIndexes) const;
 
 private:
-  std::vector<std::unique_ptr<OnlineAverage>> responderReliabilityMonitorings_;
-  std::vector<std::unique_ptr<CheckupReliability>> responderReliabilityDiagnostics_;
-  std::vector<std::unique_ptr<OnlineAverage>> initiatorReliabilityMonitorings_;
-  std::vector<std::unique_ptr<CheckupReliability>> initiatorReliabilityDiagnostics_;
+  mutable std::mutex updateMutex_;
+  size_t numberOfInitiators_;
+  std::vector<double> linksQualities_;
+  RTLSRangeStatistics rangesStatistics_;
+  RTLSReliabilityStore initiatorsReliabilities_;
+  std::atomic<RTLSReliabilityStore *> respondersReliabilities_;
+  std::vector<std::unique_ptr<RTLSReliabilityStore>> respondersReliabilitiesStores_;
+
+  mutable std::mutex reportsMutex_;
+  mutable std::vector<CachedReport> initiatorsReports_;
+  mutable std::vector<CachedReport> respondersReports_;
+  mutable std::vector<size_t> allRespondersIndexes_;
+  mutable std::vector<size_t> reportRespondersIndexes_;
+  mutable DiagnosticReport report_;
+  mutable size_t numberOfRenderedReports_;
 };
 
 }  // namespace core
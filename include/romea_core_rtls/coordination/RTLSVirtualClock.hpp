@@ -0,0 +1,71 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ROMEA_CORE_RTLS__COORDINATION__RTLSVIRTUALCLOCK_HPP_
+#define ROMEA_CORE_RTLS__COORDINATION__RTLSVIRTUALCLOCK_HPP_
+
+// std
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// romea
+#include "romea_core_rtls/coordination/RTLSClock.hpp"
+
+namespace romea
+{
+namespace core
+{
+
+// Clock only moving forward when advanced, due ticks are then fired in
+// chronological order from the calling thread
+class RTLSVirtualClock : public RTLSClock
+{
+public:
+  explicit RTLSVirtualClock(const TimePoint & startStamp = TimePoint());
+
+  ~RTLSVirtualClock() override;
+
+  TimePoint now() const override;
+
+  std::unique_ptr<RTLSTicker> createTicker(
+    TickCallback tickCallback,
+    const Duration & period) override;
+
+  void advance(const Duration & duration);
+
+  void advanceTo(const TimePoint & stamp);
+
+  // stamp of next tick or TimePoint::max() when no ticker is running
+  TimePoint getNextTickStamp() const;
+
+private:
+  class Ticker;
+
+  void registerTicker_(Ticker * ticker);
+
+  void unregisterTicker_(Ticker * ticker);
+
+  Ticker * findNextTicker_(const TimePoint & stamp) const;
+
+private:
+  mutable std::mutex mutex_;
+  TimePoint now_;
+  std::vector<Ticker *> tickers_;
+};
+
+}  // namespace core
+}  // namespace romea
+
+#endif  // ROMEA_CORE_RTLS__COORDINATION__RTLSVIRTUALCLOCK_HPP_
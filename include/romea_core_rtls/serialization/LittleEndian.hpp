@@ -0,0 +1,63 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ROMEA_CORE_RTLS__SERIALIZATION__LITTLEENDIAN_HPP_
+#define ROMEA_CORE_RTLS__SERIALIZATION__LITTLEENDIAN_HPP_
+
+// std
+#include <cstdint>
+
+namespace romea
+{
+namespace core
+{
+
+// Serialized integers are little endian whatever the host and may lie at any offset,
+// compilers turn these byte shifts into single unaligned moves on little endian hosts
+
+//-----------------------------------------------------------------------------
+inline void storeLittleEndian(const uint16_t & value, unsigned char * buffer)
+{
+  buffer[0] = static_cast<unsigned char>(value);
+  buffer[1] = static_cast<unsigned char>(value >> 8);
+}
+
+//-----------------------------------------------------------------------------
+inline void storeLittleEndian(const uint32_t & value, unsigned char * buffer)
+{
+  buffer[0] = static_cast<unsigned char>(value);
+  buffer[1] = static_cast<unsigned char>(value >> 8);
+  buffer[2] = static_cast<unsigned char>(value >> 16);
+  buffer[3] = static_cast<unsigned char>(value >> 24);
+}
+
+//-----------------------------------------------------------------------------
+inline uint16_t loadLittleEndianUint16(const unsigned char * buffer)
+{
+  return static_cast<uint16_t>(buffer[0] | buffer[1] << 8);
+}
+
+//-----------------------------------------------------------------------------
+inline uint32_t loadLittleEndianUint32(const unsigned char * buffer)
+{
+  return static_cast<uint32_t>(buffer[0]) |
+         static_cast<uint32_t>(buffer[1]) << 8 |
+         static_cast<uint32_t>(buffer[2]) << 16 |
+         static_cast<uint32_t>(buffer[3]) << 24;
+}
+
+}  // namespace core
+}  // namespace romea
+
+#endif  // ROMEA_CORE_RTLS__SERIALIZATION__LITTLEENDIAN_HPP_
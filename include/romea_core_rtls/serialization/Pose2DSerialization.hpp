@@ -20,6 +20,7 @@
 #include <Eigen/Core>
 
 // std
+#include <array>
 #include <vector>
 
 // romea
@@ -61,9 +62,30 @@ void deserializePositionCovariance(
   Eigen::Ref<Eigen::Matrix2d> covariance);
 
 
+constexpr size_t POSE2D_SERIALIZED_SIZE = 12;
+using SerializedPose2D = std::array<unsigned char, POSE2D_SERIALIZED_SIZE>;
+
 std::vector<unsigned char> serializePose2D(const Pose2D & pose);
 Pose2D deserializePose2D(const std::vector<unsigned char> & buffer);
 
+// buffers given by caller must hold POSE2D_SERIALIZED_SIZE bytes per pose
+void serializePose2D(const Pose2D & pose, unsigned char * buffer);
+void deserializePose2D(const unsigned char * buffer, Pose2D & pose);
+
+void serializePose2D(const Pose2D & pose, SerializedPose2D & buffer);
+Pose2D deserializePose2D(const SerializedPose2D & buffer);
+
+// all poses are checked before writing, buffer is left untouched when it throws
+void serializePose2DBatch(
+  const Pose2D * poses,
+  const size_t & numberOfPoses,
+  unsigned char * buffer);
+
+void deserializePose2DBatch(
+  const unsigned char * buffer,
+  const size_t & numberOfPoses,
+  Pose2D * poses);
+
 
 }  // namespace core
 }  // namespace romea
@@ -0,0 +1,147 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ROMEA_CORE_RTLS__SERIALIZATION__QUANTIZATION_HPP_
+#define ROMEA_CORE_RTLS__SERIALIZATION__QUANTIZATION_HPP_
+
+// std
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace romea
+{
+namespace core
+{
+
+// Quantization steps of serialized fields, shared by scalar codecs and batch kernels so
+// that both give the same codes and values. Integer conversions go through int32_t to
+// stay defined for negative values
+
+// Range checks, shared as well so that scalar codecs and batch kernels reject the same
+// values. Comparisons are written so that not a number values are rejected
+
+//-----------------------------------------------------------------------------
+inline bool isSerializableCartesianCoordinate(const double & value)
+{
+  return std::abs(value) <= 1000000;
+}
+
+//-----------------------------------------------------------------------------
+inline bool isSerializableOrientationVariance(const double & variance)
+{
+  return variance >= 0 && variance <= 0.199;
+}
+
+//-----------------------------------------------------------------------------
+inline bool isSerializableCentimetricStd(const double & std)
+{
+  return std >= 0 && std <= 2.;
+}
+
+//-----------------------------------------------------------------------------
+inline uint32_t quantizeCartesianCoordinate(const double & value)
+{
+  return static_cast<uint32_t>(static_cast<int32_t>(value * 1000)) + 2147483648u;
+}
+
+//-----------------------------------------------------------------------------
+inline double dequantizeCartesianCoordinate(const uint32_t & code)
+{
+  // flipping sign bit is subtracting 2^31 without widening, which keeps loops vectorizable
+  return static_cast<int32_t>(code ^ 2147483648u) / 1000.;
+}
+
+//-----------------------------------------------------------------------------
+inline uint16_t quantizeOrientation(const double & value)
+{
+  return static_cast<uint16_t>(static_cast<int32_t>((value / M_PI) * 18000 + 18000));
+}
+
+//-----------------------------------------------------------------------------
+inline double dequantizeOrientation(const uint16_t & code)
+{
+  return (static_cast<int32_t>(code) - 18000) * M_PI / 18000.;
+}
+
+//-----------------------------------------------------------------------------
+inline uint8_t quantizeOrientationVariance(const double & variance)
+{
+  return static_cast<uint8_t>(std::ceil(std::sqrt(variance) / M_PI * 1800));
+}
+
+//-----------------------------------------------------------------------------
+inline double dequantizeOrientationVariance(const uint8_t & code)
+{
+  double std = (code * M_PI) / 1800.;
+  return std * std;
+}
+
+//-----------------------------------------------------------------------------
+inline uint8_t quantizeCentimetricStd(const double & std)
+{
+  return static_cast<uint8_t>(std::ceil(std * 100));
+}
+
+//-----------------------------------------------------------------------------
+inline double dequantizeCentimetricVariance(const uint8_t & code)
+{
+  double std = code / 100.;
+  return std * std;
+}
+
+//-----------------------------------------------------------------------------
+inline uint16_t quantizeLinearSpeed(const double & value)
+{
+  return static_cast<uint16_t>(static_cast<int32_t>(value * 1000) + 32768);
+}
+
+//-----------------------------------------------------------------------------
+inline double dequantizeLinearSpeed(const uint16_t & code)
+{
+  return (static_cast<int32_t>(code) - 32768) / 1000.0;
+}
+
+//-----------------------------------------------------------------------------
+inline uint16_t quantizeAngularSpeed(const double & value)
+{
+  return static_cast<uint16_t>(static_cast<int32_t>(value / M_PI * 18000) + 32768);
+}
+
+//-----------------------------------------------------------------------------
+inline double dequantizeAngularSpeed(const uint16_t & code)
+{
+  return (static_cast<int32_t>(code) - 32768) * M_PI / 18000.0;
+}
+
+// Batch kernels over contiguous arrays written as plain loops that compilers vectorize,
+// except variances quantization which needs square roots and ceilings. They throw like
+// scalar codecs when a value cannot be serialized, before writing any code
+
+void quantizeCartesianCoordinates(const double * values, const size_t & size, uint32_t * codes);
+void dequantizeCartesianCoordinates(const uint32_t * codes, const size_t & size, double * values);
+
+void quantizeOrientations(const double * values, const size_t & size, uint16_t * codes);
+void dequantizeOrientations(const uint16_t * codes, const size_t & size, double * values);
+
+void quantizeOrientationVariances(const double * variances, const size_t & size, uint8_t * codes);
+void dequantizeOrientationVariances(const uint8_t * codes, const size_t & size, double * variances);
+
+void quantizeCentimetricStds(const double * stds, const size_t & size, uint8_t * codes);
+void dequantizeCentimetricVariances(const uint8_t * codes, const size_t & size, double * variances);
+
+}  // namespace core
+}  // namespace romea
+
+#endif  // ROMEA_CORE_RTLS__SERIALIZATION__QUANTIZATION_HPP_
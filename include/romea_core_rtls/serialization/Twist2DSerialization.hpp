@@ -17,6 +17,7 @@
 #define ROMEA_CORE_RTLS__SERIALIZATION__TWIST2DSERIALIZATION_HPP_
 
 // std
+#include <array>
 #include <vector>
 
 // romea
@@ -61,10 +62,32 @@ void deserializeLinearSpeedsCovariance(
   Eigen::Ref<Eigen::Matrix2d> covariance);
 
 
+constexpr size_t TWIST2D_SERIALIZED_SIZE = 9;
+using SerializedTwist2D = std::array<unsigned char, TWIST2D_SERIALIZED_SIZE>;
+
 std::vector<unsigned char> serializeTwist2D(const Twist2D & twist);
 
 Twist2D deserializeTwist2D(const std::vector<unsigned char> & twist);
 
+// buffers given by caller must hold TWIST2D_SERIALIZED_SIZE bytes per twist
+void serializeTwist2D(const Twist2D & twist, unsigned char * buffer);
+
+void deserializeTwist2D(const unsigned char * buffer, Twist2D & twist);
+
+void serializeTwist2D(const Twist2D & twist, SerializedTwist2D & buffer);
+
+Twist2D deserializeTwist2D(const SerializedTwist2D & buffer);
+
+void serializeTwist2DBatch(
+  const Twist2D * twists,
+  const size_t & numberOfTwists,
+  unsigned char * buffer);
+
+void deserializeTwist2DBatch(
+  const unsigned char * buffer,
+  const size_t & numberOfTwists,
+  Twist2D * twists);
+
 }  // namespace core
 }  // namespace romea
 
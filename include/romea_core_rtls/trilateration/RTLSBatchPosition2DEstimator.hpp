@@ -0,0 +1,105 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ROMEA_CORE_RTLS__TRILATERATION__RTLSBATCHPOSITION2DESTIMATOR_HPP_
+#define ROMEA_CORE_RTLS__TRILATERATION__RTLSBATCHPOSITION2DESTIMATOR_HPP_
+
+// Eigen
+#include <Eigen/Core>
+
+// std
+#include <optional>
+#include <vector>
+
+// romea
+#include "romea_core_common/containers/Eigen/VectorOfEigenVector.hpp"
+
+namespace romea
+{
+namespace core
+{
+
+// Ranges are stored as structure of arrays (one column of target tags per reference tag)
+// in order to run Gauss-Newton iterations of all target tags at once
+class RTLSBatchPosition2DEstimator
+{
+public:
+  using RangeVector = std::vector<std::optional<double>>;
+  using RangeArray = std::vector<RangeVector>;
+
+public:
+  RTLSBatchPosition2DEstimator(
+    const VectorOfEigenVector3d & referenceTagPositions,
+    const double & estimateEpsilon = 0.01);
+
+  bool init(const RangeArray & ranges);
+
+  bool estimate(const size_t & maximalNumberOfIterations, const double & dataStd);
+
+  size_t getNumberOfTargetTags() const;
+
+  bool isEstimated(const size_t & targetTagIndex) const;
+
+  Eigen::Vector2d getEstimate(const size_t & targetTagIndex) const;
+
+  Eigen::Matrix2d getEstimateCovariance(const size_t & targetTagIndex) const;
+
+private:
+  void computeGuess_();
+
+  void computeNormalEquations_();
+
+  void computeCorrections_();
+
+private:
+  double estimateEpsilon_;
+  VectorOfEigenVector2d referenceTagPositions_;
+  Eigen::ArrayXd referenceTagXs_;
+  Eigen::ArrayXd referenceTagYs_;
+
+  Eigen::ArrayXXd ranges_;
+  Eigen::ArrayXXd availabilities_;
+  Eigen::ArrayXd solvables_;
+  Eigen::ArrayXd convergeds_;
+  Eigen::ArrayXd actives_;
+  Eigen::ArrayXd divergings_;
+
+  Eigen::ArrayXd xs_;
+  Eigen::ArrayXd ys_;
+  Eigen::ArrayXd dxs_;
+  Eigen::ArrayXd dys_;
+  Eigen::ArrayXd ds_;
+
+  Eigen::ArrayXd jtjxx_;
+  Eigen::ArrayXd jtjxy_;
+  Eigen::ArrayXd jtjyy_;
+  Eigen::ArrayXd jtyx_;
+  Eigen::ArrayXd jtyy_;
+  Eigen::ArrayXd correctionXs_;
+  Eigen::ArrayXd correctionYs_;
+  Eigen::ArrayXd correctionNorms_;
+  Eigen::ArrayXd previousCorrectionNorms_;
+  Eigen::ArrayXd residuals_;
+  Eigen::ArrayXd previousResiduals_;
+
+  double dataStd_;
+
+  std::vector<double> guessRanges_;
+  std::vector<size_t> guessIndexesOfAvailableRanges_;
+};
+
+}  // namespace core
+}  // namespace romea
+
+#endif  // ROMEA_CORE_RTLS__TRILATERATION__RTLSBATCHPOSITION2DESTIMATOR_HPP_
@@ -0,0 +1,122 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ROMEA_CORE_RTLS__TRILATERATION__RTLSFIXEDSIZENLSE_HPP_
+#define ROMEA_CORE_RTLS__TRILATERATION__RTLSFIXEDSIZENLSE_HPP_
+
+// Eigen
+#include <Eigen/Core>
+#include <Eigen/LU>
+
+// std
+#include <cassert>
+#include <cmath>
+
+namespace romea
+{
+namespace core
+{
+
+// Gauss-Newton solver with compile time sized storage: jacobian and residuals are
+// bounded by MaximalDataSize so a solve never allocates, and guess and jacobian
+// computations are statically dispatched to Derived (CRTP)
+template<typename Derived, int EstimateSize, int MaximalDataSize>
+class RTLSFixedSizeNLSE
+{
+public:
+  using Estimate = Eigen::Matrix<double, EstimateSize, 1>;
+  using EstimateCovariance = Eigen::Matrix<double, EstimateSize, EstimateSize>;
+  using Jacobian = Eigen::Matrix<double, Eigen::Dynamic, EstimateSize,
+      Eigen::ColMajor, MaximalDataSize, EstimateSize>;
+  using Residuals = Eigen::Matrix<double, Eigen::Dynamic, 1,
+      Eigen::ColMajor, MaximalDataSize, 1>;
+
+public:
+  explicit RTLSFixedSizeNLSE(const double & estimateEpsilon)
+  : estimateEpsilon_(estimateEpsilon),
+    estimate_(Estimate::Zero()),
+    estimateCovariance_(EstimateCovariance::Zero()),
+    rootMeanSquareError_(0),
+    J_(),
+    Y_()
+  {
+  }
+
+  bool estimate(const size_t & maximalNumberOfIterations, const double & dataStd)
+  {
+    derived_().computeGuess_();
+
+    for (size_t n = 0; n < maximalNumberOfIterations; ++n) {
+      derived_().computeJacobianAndY_();
+
+      EstimateCovariance JtJ = J_.transpose().lazyProduct(J_);
+      Estimate correction = JtJ.inverse() * J_.transpose().lazyProduct(Y_);
+      if (!correction.allFinite()) {
+        return false;
+      }
+
+      estimate_ -= correction;
+      if (correction.norm() < estimateEpsilon_) {
+        derived_().computeJacobianAndY_();
+        rootMeanSquareError_ = std::sqrt(Y_.squaredNorm() / Y_.rows());
+        estimateCovariance_ = J_.transpose().lazyProduct(J_).eval().inverse() * dataStd * dataStd;
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  const Estimate & getEstimate() const
+  {
+    return estimate_;
+  }
+
+  const EstimateCovariance & getEstimateCovariance() const
+  {
+    return estimateCovariance_;
+  }
+
+  const double & getRootMeanSquareError() const
+  {
+    return rootMeanSquareError_;
+  }
+
+protected:
+  void setDataSize_(const size_t & dataSize)
+  {
+    assert(dataSize <= MaximalDataSize);
+    J_.resize(static_cast<Eigen::Index>(dataSize), EstimateSize);
+    Y_.resize(static_cast<Eigen::Index>(dataSize));
+  }
+
+private:
+  Derived & derived_()
+  {
+    return static_cast<Derived &>(*this);
+  }
+
+protected:
+  double estimateEpsilon_;
+  Estimate estimate_;
+  EstimateCovariance estimateCovariance_;
+  double rootMeanSquareError_;
+  Jacobian J_;
+  Residuals Y_;
+};
+
+}  // namespace core
+}  // namespace romea
+
+#endif  // ROMEA_CORE_RTLS__TRILATERATION__RTLSFIXEDSIZENLSE_HPP_
@@ -0,0 +1,218 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ROMEA_CORE_RTLS__TRILATERATION__RTLSFIXEDSIZEPOSE2DESTIMATOR_HPP_
+#define ROMEA_CORE_RTLS__TRILATERATION__RTLSFIXEDSIZEPOSE2DESTIMATOR_HPP_
+
+// std
+#include <array>
+#include <cassert>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+// romea
+#include "romea_core_common/containers/Eigen/VectorOfEigenVector.hpp"
+#include "romea_core_rtls/trilateration/RTLSFixedSizeNLSE.hpp"
+#include "romea_core_rtls/trilateration/RTLSSimpleTrilateration2D.hpp"
+
+namespace romea
+{
+namespace core
+{
+
+template<int MaximalNumberOfTargetTags, int MaximalNumberOfReferenceTags>
+class RTLSFixedSizePose2DEstimator
+  : public RTLSFixedSizeNLSE<
+    RTLSFixedSizePose2DEstimator<MaximalNumberOfTargetTags, MaximalNumberOfReferenceTags>,
+    3, MaximalNumberOfTargetTags * MaximalNumberOfReferenceTags>
+{
+public:
+  using Base = RTLSFixedSizeNLSE<
+    RTLSFixedSizePose2DEstimator<MaximalNumberOfTargetTags, MaximalNumberOfReferenceTags>,
+    3, MaximalNumberOfTargetTags * MaximalNumberOfReferenceTags>;
+  using RangeVector = std::vector<std::optional<double>>;
+  using RangeArray = std::vector<RangeVector>;
+
+  friend Base;
+
+public:
+  RTLSFixedSizePose2DEstimator(
+    const VectorOfEigenVector3d & targetTagPositions,
+    const VectorOfEigenVector3d & referenceTagPositions,
+    const double & estimateEpsilon = 0.01);
+
+  bool init(const RangeArray & ranges);
+
+private:
+  void computeGuess_();
+
+  void computeJacobianAndY_();
+
+private:
+  size_t numberOfTargetTags_;
+  size_t numberOfReferenceTags_;
+  Eigen::Matrix<double, 2, MaximalNumberOfTargetTags> targetTagPositions_;
+  Eigen::Matrix<double, 2, MaximalNumberOfReferenceTags> referenceTagPositions_;
+  Eigen::Matrix<double, MaximalNumberOfTargetTags, MaximalNumberOfReferenceTags> ranges_;
+  std::array<std::array<size_t, MaximalNumberOfReferenceTags>,
+    MaximalNumberOfTargetTags> indexesOfAvailableRanges_;
+  std::array<size_t, MaximalNumberOfTargetTags> numberOfAvailableRanges_;
+};
+
+//-----------------------------------------------------------------------------
+template<int MaximalNumberOfTargetTags, int MaximalNumberOfReferenceTags>
+RTLSFixedSizePose2DEstimator<MaximalNumberOfTargetTags, MaximalNumberOfReferenceTags>::
+RTLSFixedSizePose2DEstimator(
+  const VectorOfEigenVector3d & targetTagPositions,
+  const VectorOfEigenVector3d & referenceTagPositions,
+  const double & estimateEpsilon)
+: Base(estimateEpsilon),
+  numberOfTargetTags_(targetTagPositions.size()),
+  numberOfReferenceTags_(referenceTagPositions.size()),
+  targetTagPositions_(),
+  referenceTagPositions_(),
+  ranges_(),
+  indexesOfAvailableRanges_(),
+  numberOfAvailableRanges_()
+{
+  if (targetTagPositions.size() > MaximalNumberOfTargetTags ||
+    referenceTagPositions.size() > MaximalNumberOfReferenceTags)
+  {
+    throw std::runtime_error(
+            "Cannot create fixed size pose estimator because there are too many tags");
+  }
+
+  for (size_t i = 0; i < numberOfTargetTags_; ++i) {
+    targetTagPositions_.col(i) = targetTagPositions[i].head<2>();
+  }
+
+  for (size_t j = 0; j < numberOfReferenceTags_; ++j) {
+    referenceTagPositions_.col(j) = referenceTagPositions[j].head<2>();
+  }
+}
+
+//-----------------------------------------------------------------------------
+template<int MaximalNumberOfTargetTags, int MaximalNumberOfReferenceTags>
+bool RTLSFixedSizePose2DEstimator<MaximalNumberOfTargetTags, MaximalNumberOfReferenceTags>::init(
+  const RangeArray & ranges)
+{
+  constexpr size_t MINIMAL_NUMBER_OF_RANGES_TO_COMPUTE_POSITION = 3;
+
+  assert(ranges.size() == numberOfTargetTags_);
+  assert(ranges[0].size() == numberOfReferenceTags_);
+
+  size_t n = 0;
+  for (size_t i = 0; i < numberOfTargetTags_; i++) {
+    numberOfAvailableRanges_[i] = 0;
+    for (size_t j = 0; j < numberOfReferenceTags_; j++) {
+      const auto & range = ranges[i][j];
+      if (range.has_value()) {
+        indexesOfAvailableRanges_[i][numberOfAvailableRanges_[i]++] = j;
+        ranges_(i, j) = range.value();
+        n++;
+      }
+    }
+
+    if (numberOfAvailableRanges_[i] != numberOfReferenceTags_ &&
+      numberOfAvailableRanges_[i] < MINIMAL_NUMBER_OF_RANGES_TO_COMPUTE_POSITION)
+    {
+      return false;
+    }
+  }
+
+  this->setDataSize_(n);
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+template<int MaximalNumberOfTargetTags, int MaximalNumberOfReferenceTags>
+void RTLSFixedSizePose2DEstimator<MaximalNumberOfTargetTags, MaximalNumberOfReferenceTags>::
+computeGuess_()
+{
+  Eigen::Matrix<double, 2, MaximalNumberOfTargetTags> targetTagGuessPositions;
+  for (size_t i = 0; i < numberOfTargetTags_; i++) {
+    targetTagGuessPositions.col(i) = SimpleTrilateration2D::computeFromAccessors(
+      numberOfAvailableRanges_[i],
+      [this, i](const size_t & n) -> Eigen::Vector2d {
+        return referenceTagPositions_.col(indexesOfAvailableRanges_[i][n]);
+      },
+      [this, i](const size_t & n) {return ranges_(i, indexesOfAvailableRanges_[i][n]);});
+  }
+
+  // closed form 2D rigid registration of target tags onto their guess positions
+  auto sources = targetTagPositions_.leftCols(numberOfTargetTags_);
+  auto targets = targetTagGuessPositions.leftCols(numberOfTargetTags_);
+  Eigen::Vector2d sourcesCentroid = sources.rowwise().mean();
+  Eigen::Vector2d targetsCentroid = targets.rowwise().mean();
+
+  double dot = 0;
+  double cross = 0;
+  for (size_t i = 0; i < numberOfTargetTags_; i++) {
+    Eigen::Vector2d s = sources.col(i) - sourcesCentroid;
+    Eigen::Vector2d t = targets.col(i) - targetsCentroid;
+    dot += s.dot(t);
+    cross += s.x() * t.y() - s.y() * t.x();
+  }
+
+  double o = std::atan2(cross, dot);
+  Eigen::Matrix2d R;
+  R << std::cos(o), -std::sin(o), std::sin(o), std::cos(o);
+  this->estimate_.template head<2>() = targetsCentroid - R * sourcesCentroid;
+  this->estimate_(2) = o;
+}
+
+//-----------------------------------------------------------------------------
+template<int MaximalNumberOfTargetTags, int MaximalNumberOfReferenceTags>
+void RTLSFixedSizePose2DEstimator<MaximalNumberOfTargetTags, MaximalNumberOfReferenceTags>::
+computeJacobianAndY_()
+{
+  auto & J = this->J_;
+  auto & Y = this->Y_;
+
+  double x = this->estimate_(0);
+  double y = this->estimate_(1);
+  double o = this->estimate_(2);
+
+  double coso = std::cos(o);
+  double sino = std::sin(o);
+
+  size_t n = 0;
+  for (size_t i = 0; i < numberOfTargetTags_; i++) {
+    double xt = targetTagPositions_(0, i);
+    double yt = targetTagPositions_(1, i);
+
+    for (size_t k = 0; k < numberOfAvailableRanges_[i]; k++) {
+      const size_t j = indexesOfAvailableRanges_[i][k];
+      double xr = referenceTagPositions_(0, j);
+      double yr = referenceTagPositions_(1, j);
+
+      double alpha = x + xt * coso - yt * sino - xr;
+      double gamma = y + xt * sino + yt * coso - yr;
+      Y(n) = std::sqrt(alpha * alpha + gamma * gamma);
+
+      J(n, 0) = alpha / Y(n);
+      J(n, 1) = gamma / Y(n);
+      J(n, 2) = (alpha * (-xt * sino - yt * coso) + gamma * (xt * coso - yt * sino)) / Y(n);
+
+      Y(n) -= ranges_(i, j);
+      n++;
+    }
+  }
+}
+
+}  // namespace core
+}  // namespace romea
+
+#endif  // ROMEA_CORE_RTLS__TRILATERATION__RTLSFIXEDSIZEPOSE2DESTIMATOR_HPP_
@@ -0,0 +1,157 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ROMEA_CORE_RTLS__TRILATERATION__RTLSFIXEDSIZEPOSITION2DESTIMATOR_HPP_
+#define ROMEA_CORE_RTLS__TRILATERATION__RTLSFIXEDSIZEPOSITION2DESTIMATOR_HPP_
+
+// std
+#include <array>
+#include <cassert>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+// romea
+#include "romea_core_common/containers/Eigen/VectorOfEigenVector.hpp"
+#include "romea_core_rtls/trilateration/RTLSFixedSizeNLSE.hpp"
+#include "romea_core_rtls/trilateration/RTLSSimpleTrilateration2D.hpp"
+
+namespace romea
+{
+namespace core
+{
+
+template<int MaximalNumberOfReferenceTags>
+class RTLSFixedSizePosition2DEstimator
+  : public RTLSFixedSizeNLSE<
+    RTLSFixedSizePosition2DEstimator<MaximalNumberOfReferenceTags>,
+    2, MaximalNumberOfReferenceTags>
+{
+public:
+  using Base = RTLSFixedSizeNLSE<
+    RTLSFixedSizePosition2DEstimator<MaximalNumberOfReferenceTags>,
+    2, MaximalNumberOfReferenceTags>;
+  using RangeVector = std::vector<std::optional<double>>;
+
+  friend Base;
+
+public:
+  explicit RTLSFixedSizePosition2DEstimator(
+    const VectorOfEigenVector3d & referenceTagPositions,
+    const double & estimateEpsilon = 0.01);
+
+  bool init(const RangeVector & ranges);
+
+private:
+  void computeGuess_();
+
+  void computeJacobianAndY_();
+
+private:
+  size_t numberOfReferenceTags_;
+  Eigen::Matrix<double, 2, MaximalNumberOfReferenceTags> referenceTagPositions_;
+  Eigen::Matrix<double, MaximalNumberOfReferenceTags, 1> ranges_;
+  std::array<size_t, MaximalNumberOfReferenceTags> indexesOfAvailableRanges_;
+  size_t numberOfAvailableRanges_;
+};
+
+//-----------------------------------------------------------------------------
+template<int MaximalNumberOfReferenceTags>
+RTLSFixedSizePosition2DEstimator<MaximalNumberOfReferenceTags>::
+RTLSFixedSizePosition2DEstimator(
+  const VectorOfEigenVector3d & referenceTagPositions,
+  const double & estimateEpsilon)
+: Base(estimateEpsilon),
+  numberOfReferenceTags_(referenceTagPositions.size()),
+  referenceTagPositions_(),
+  ranges_(),
+  indexesOfAvailableRanges_(),
+  numberOfAvailableRanges_(0)
+{
+  if (referenceTagPositions.size() > MaximalNumberOfReferenceTags) {
+    throw std::runtime_error(
+            "Cannot create fixed size position estimator because there are too many tags");
+  }
+
+  for (size_t n = 0; n < numberOfReferenceTags_; ++n) {
+    referenceTagPositions_.col(n) = referenceTagPositions[n].head<2>();
+  }
+}
+
+//-----------------------------------------------------------------------------
+template<int MaximalNumberOfReferenceTags>
+bool RTLSFixedSizePosition2DEstimator<MaximalNumberOfReferenceTags>::init(
+  const RangeVector & ranges)
+{
+  constexpr size_t MINIMAL_NUMBER_OF_RANGES_TO_COMPUTE_POSITION = 2;
+
+  if (numberOfReferenceTags_ == 0) {
+    return false;
+  }
+
+  assert(ranges.size() == numberOfReferenceTags_);
+
+  numberOfAvailableRanges_ = 0;
+  for (size_t n = 0; n < numberOfReferenceTags_; ++n) {
+    if (ranges[n].has_value()) {
+      indexesOfAvailableRanges_[numberOfAvailableRanges_++] = n;
+      ranges_(n) = ranges[n].value();
+    }
+  }
+
+  if (numberOfAvailableRanges_ == numberOfReferenceTags_ ||
+    numberOfAvailableRanges_ > MINIMAL_NUMBER_OF_RANGES_TO_COMPUTE_POSITION)
+  {
+    this->setDataSize_(numberOfAvailableRanges_);
+    return true;
+  } else {
+    return false;
+  }
+}
+
+//-----------------------------------------------------------------------------
+template<int MaximalNumberOfReferenceTags>
+void RTLSFixedSizePosition2DEstimator<MaximalNumberOfReferenceTags>::computeGuess_()
+{
+  this->estimate_ = SimpleTrilateration2D::computeFromAccessors(
+    numberOfAvailableRanges_,
+    [this](const size_t & n) -> Eigen::Vector2d {
+      return referenceTagPositions_.col(indexesOfAvailableRanges_[n]);
+    },
+    [this](const size_t & n) {return ranges_(indexesOfAvailableRanges_[n]);});
+}
+
+//-----------------------------------------------------------------------------
+template<int MaximalNumberOfReferenceTags>
+void RTLSFixedSizePosition2DEstimator<MaximalNumberOfReferenceTags>::computeJacobianAndY_()
+{
+  auto & J = this->J_;
+  auto & Y = this->Y_;
+
+  for (size_t n = 0; n < numberOfAvailableRanges_; ++n) {
+    size_t rangeIndex = indexesOfAvailableRanges_[n];
+    double dx = this->estimate_(0) - referenceTagPositions_(0, rangeIndex);
+    double dy = this->estimate_(1) - referenceTagPositions_(1, rangeIndex);
+
+    Y(n) = std::sqrt(dx * dx + dy * dy);
+    J(n, 0) = dx / Y(n);
+    J(n, 1) = dy / Y(n);
+    Y(n) -= ranges_(rangeIndex);
+  }
+}
+
+}  // namespace core
+}  // namespace romea
+
+#endif  // ROMEA_CORE_RTLS__TRILATERATION__RTLSFIXEDSIZEPOSITION2DESTIMATOR_HPP_
@@ -22,6 +22,7 @@
 // romea
 #include "romea_core_common/regression/leastsquares/NLSE.hpp"
 #include "romea_core_common/containers/Eigen/VectorOfEigenVector.hpp"
+#include "romea_core_common/geometry/Twist2D.hpp"
 
 namespace romea
 {
@@ -42,16 +43,39 @@ public:
 
   bool init(const RangeArray & ranges);
 
+  bool estimate(const size_t & maximalNumberOfIterations, const double & dataStd);
+
+  void enableTracking(const double & maximalGuessResidual, const double & maximalJump);
+
+  void disableTracking();
+
+  // Twist linear speeds are expressed in body frame and rotated by the last estimated
+  // course, which is then integrated with angular speed
+  void predict(const Twist2D & twist, const double & dt);
+
+  bool isTrackingGuessUsed() const;
+
 private:
   void computeGuess_()override;
 
   void computeJacobianAndY_()override;
 
+  bool computeTrackingGuess_();
+
 private:
   VectorOfEigenVector2d targetTagPositions_;
   VectorOfEigenVector2d referenceTagPositions_;
   std::vector<std::vector<double>> ranges_;
   std::vector<std::vector<size_t>> indexesOfAvailableRanges_;
+
+  bool isTrackingEnabled_;
+  bool isTrackingGuessAllowed_;
+  bool isTrackingGuessUsed_;
+  bool isLastEstimateAvailable_;
+  double maximalGuessResidual_;
+  double maximalJump_;
+  Eigen::Vector3d lastEstimate_;
+  Eigen::Vector3d trackingGuess_;
 };
 
 }  // namespace core
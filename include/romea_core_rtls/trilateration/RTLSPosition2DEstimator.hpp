@@ -15,40 +15,48 @@
 #ifndef ROMEA_CORE_RTLS__TRILATERATION__RTLSPOSITION2DESTIMATOR_HPP_
 #define ROMEA_CORE_RTLS__TRILATERATION__RTLSPOSITION2DESTIMATOR_HPP_
 
-// std
-#include <optional>
-#include <vector>
-
 // romea
-#include "romea_core_common/regression/leastsquares/NLSE.hpp"
-#include "romea_core_common/containers/Eigen/VectorOfEigenVector.hpp"
+#include "romea_core_common/geometry/Twist2D.hpp"
+#include "romea_core_rtls/trilateration/RTLSPosition2DEstimatorBase.hpp"
 
 namespace romea
 {
 namespace core
 {
 
-class RTLSPosition2DEstimator : public NLSE<double>
+class RTLSPosition2DEstimator : public RTLSPosition2DEstimatorBase
 {
-public:
-  using RangeVector = std::vector<std::optional<double>>;
-
 public:
   RTLSPosition2DEstimator(
     const VectorOfEigenVector3d & referenceTagPosition,
     const double & estimateEpsilon = 0.01);
 
-  bool init(const RangeVector & ranges);
+  bool estimate(const size_t & maximalNumberOfIterations, const double & dataStd);
+
+  void enableTracking(const double & maximalGuessResidual, const double & maximalJump);
+
+  void disableTracking();
+
+  // Twist linear speeds are expressed in body frame and rotated by heading, the tag has
+  // no orientation so its heading comes from another source and angular speed is unused
+  void predict(const Twist2D & twist, const double & heading, const double & dt);
+
+  bool isTrackingGuessUsed() const;
 
 private:
   void computeGuess_()override;
 
-  void computeJacobianAndY_()override;
+  bool computeTrackingGuess_();
 
 private:
-  VectorOfEigenVector2d referenceTagPositions_;
-  std::vector<size_t> indexesOfAvailableRanges_;
-  std::vector<double> ranges_;
+  bool isTrackingEnabled_;
+  bool isTrackingGuessAllowed_;
+  bool isTrackingGuessUsed_;
+  bool isLastEstimateAvailable_;
+  double maximalGuessResidual_;
+  double maximalJump_;
+  Eigen::Vector2d lastEstimate_;
+  Eigen::Vector2d trackingGuess_;
 };
 
 }  // namespace core
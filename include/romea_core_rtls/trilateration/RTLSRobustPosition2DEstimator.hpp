@@ -0,0 +1,76 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ROMEA_CORE_RTLS__TRILATERATION__RTLSROBUSTPOSITION2DESTIMATOR_HPP_
+#define ROMEA_CORE_RTLS__TRILATERATION__RTLSROBUSTPOSITION2DESTIMATOR_HPP_
+
+// std
+#include <vector>
+
+// romea
+#include "romea_core_rtls/trilateration/RTLSPosition2DEstimatorBase.hpp"
+
+namespace romea
+{
+namespace core
+{
+
+class RTLSRobustPosition2DEstimator : public RTLSPosition2DEstimatorBase
+{
+public:
+  enum class Loss
+  {
+    HUBER,
+    TUKEY
+  };
+
+public:
+  RTLSRobustPosition2DEstimator(
+    const VectorOfEigenVector3d & referenceTagPositions,
+    const double & estimateEpsilon = 0.01,
+    const Loss & loss = Loss::HUBER,
+    const double & lossScale = 0.2,
+    const double & inlierThreshold = 0.5,
+    const size_t & maximalNumberOfHypotheses = 16);
+
+  bool estimate(const size_t & maximalNumberOfIterations, const double & dataStd);
+
+  const std::vector<size_t> & getInliersIndexes() const;
+
+  size_t getNumberOfEvaluatedHypotheses() const;
+
+private:
+  void computeGuess_()override;
+
+  double computeResidualSqrtWeight_(const double & residual) const override;
+
+  double computeWeight_(const double & residual) const;
+
+  size_t countInliers_(const Eigen::Vector2d & position, double & inliersResidual) const;
+
+  void selectInliers_(const Eigen::Vector2d & position);
+
+private:
+  Loss loss_;
+  double lossScale_;
+  double inlierThreshold_;
+  size_t maximalNumberOfHypotheses_;
+  size_t numberOfEvaluatedHypotheses_;
+  std::vector<size_t> inliersIndexes_;
+};
+
+}  // namespace core
+}  // namespace romea
+
+#endif  // ROMEA_CORE_RTLS__TRILATERATION__RTLSROBUSTPOSITION2DESTIMATOR_HPP_
@@ -16,6 +16,9 @@
 #define ROMEA_CORE_RTLS__TRILATERATION__RTLSSIMPLETRILATERATION2D_HPP_
 
 // std
+#include <array>
+#include <cassert>
+#include <cmath>
 #include <vector>
 
 // romea
@@ -39,6 +42,37 @@ public:
     const std::vector<double> & ranges,
     const std::vector<size_t> & rangesIndexes);
 
+  // Falls back to compute when less than three ranges are given or reference tags are
+  // collinear: the tag is then only known up to its mirror image across their line and
+  // the solution with a positive x is preferred
+  static Eigen::Vector2d computeByLinearLeastSquares(
+    const VectorOfEigenVector2d & tagPositions,
+    const std::vector<double> & ranges);
+
+  static Eigen::Vector2d computeByLinearLeastSquares(
+    const VectorOfEigenVector2d & tagPositions,
+    const std::vector<double> & ranges,
+    const std::vector<size_t> & rangesIndexes);
+
+  template<typename PositionFunction, typename RangeFunction>
+  static bool computeByLinearLeastSquares(
+    const size_t & numberOfRanges,
+    PositionFunction position,
+    RangeFunction range,
+    Eigen::Vector2d & solution);
+
+  template<typename PositionFunction, typename RangeFunction>
+  static Eigen::Vector2d computeFromAccessors(
+    const size_t & numberOfRanges,
+    PositionFunction position,
+    RangeFunction range);
+
+  static std::array<Eigen::Vector2d, 2> computeIntersections(
+    const Eigen::Vector2d & p1,
+    const Eigen::Vector2d & p2,
+    const double & r1,
+    const double & r2);
+
 private:
   static Eigen::Vector2d compute_(
     const VectorOfEigenVector2d & tagPositions,
@@ -52,14 +86,84 @@ private:
     const std::vector<size_t> & rangesIndexes,
     const size_t & i,
     const size_t & j);
-
-  static VectorOfEigenVector2d compute_(
-    const Eigen::Vector2d & p1,
-    const Eigen::Vector2d & p2,
-    const double & r1,
-    const double & r2);
 };
 
+//-----------------------------------------------------------------------------
+template<typename PositionFunction, typename RangeFunction>
+bool SimpleTrilateration2D::computeByLinearLeastSquares(
+  const size_t & numberOfRanges,
+  PositionFunction position,
+  RangeFunction range,
+  Eigen::Vector2d & solution)
+{
+  constexpr size_t MINIMAL_NUMBER_OF_RANGES = 3;
+  constexpr double MINIMAL_NORMAL_MATRIX_CONDITIONING = 1e-6;
+
+  if (numberOfRanges < MINIMAL_NUMBER_OF_RANGES) {
+    return false;
+  }
+
+  // Differences of squared ranges with respect to their mean give the linear system
+  // 2 (p_i - p_mean)^T x = |p_i|^2 - mean(|p|^2) - r_i^2 + mean(r^2)
+  Eigen::Vector2d meanPosition = Eigen::Vector2d::Zero();
+  double meanSquaredNorm = 0;
+  double meanSquaredRange = 0;
+  for (size_t n = 0; n < numberOfRanges; ++n) {
+    meanPosition += position(n);
+    meanSquaredNorm += position(n).squaredNorm();
+    meanSquaredRange += range(n) * range(n);
+  }
+  meanPosition /= numberOfRanges;
+  meanSquaredNorm /= numberOfRanges;
+  meanSquaredRange /= numberOfRanges;
+
+  Eigen::Matrix2d AtA = Eigen::Matrix2d::Zero();
+  Eigen::Vector2d Atb = Eigen::Vector2d::Zero();
+  for (size_t n = 0; n < numberOfRanges; ++n) {
+    Eigen::Vector2d a = 2 * (position(n) - meanPosition);
+    double b = position(n).squaredNorm() - meanSquaredNorm - range(n) * range(n) + meanSquaredRange;
+    AtA += a * a.transpose();
+    Atb += a * b;
+  }
+
+  // collinear tags cannot disambiguate both sides of their line
+  double det = AtA(0, 0) * AtA(1, 1) - AtA(0, 1) * AtA(1, 0);
+  double trace = AtA.trace();
+  if (det <= MINIMAL_NORMAL_MATRIX_CONDITIONING * trace * trace) {
+    return false;
+  }
+
+  solution.x() = (AtA(1, 1) * Atb.x() - AtA(0, 1) * Atb.y()) / det;
+  solution.y() = (AtA(0, 0) * Atb.y() - AtA(1, 0) * Atb.x()) / det;
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+template<typename PositionFunction, typename RangeFunction>
+Eigen::Vector2d SimpleTrilateration2D::computeFromAccessors(
+  const size_t & numberOfRanges,
+  PositionFunction position,
+  RangeFunction range)
+{
+  assert(numberOfRanges >= 2);
+
+  Eigen::Vector2d solution;
+  if (computeByLinearLeastSquares(numberOfRanges, position, range, solution)) {
+    return solution;
+  }
+
+  std::array<Eigen::Vector2d, 2> solutions =
+    computeIntersections(position(0), position(1), range(0), range(1));
+
+  std::array<double, 2> errors = {0, 0};
+  for (size_t n = 2; n < numberOfRanges; ++n) {
+    errors[0] += std::abs((position(n) - solutions[0]).norm() - range(n));
+    errors[1] += std::abs((position(n) - solutions[1]).norm() - range(n));
+  }
+
+  return errors[0] <= errors[1] ? solutions[0] : solutions[1];
+}
+
 }  // namespace core
 }  // namespace romea
 
@@ -0,0 +1,277 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+#include <vector>
+
+// romea
+#include "romea_core_rtls/coordination/RTLSChannelArbiter.hpp"
+
+namespace romea
+{
+namespace core
+{
+
+//-----------------------------------------------------------------------------
+RTLSChannelArbiter::RTLSChannelArbiter(
+  const Duration & slotDuration,
+  std::shared_ptr<RTLSClock> clock)
+: mutex_(),
+  slotDuration_(slotDuration),
+  robotsRangingRequestCallbacks_(),
+  robotsRangingDispatchCallbacks_(),
+  robotsRangingDropCallbacks_(),
+  robotsReachableResponders_(),
+  robotsSlots_(),
+  robotsPendingRequestsFlags_(),
+  robotsPendingRequests_(),
+  robotsNumberOfDroppedRequests_(),
+  dispatchedRequests_(),
+  areSlotsOutdated_(false),
+  numberOfSlots_(1),
+  currentSlot_(0),
+  clock_(clock),
+  ticker_(clock_->createTicker(
+      std::bind(&RTLSChannelArbiter::timerCallback_, this), slotDuration))
+{
+}
+
+//-----------------------------------------------------------------------------
+size_t RTLSChannelArbiter::addRobot(
+  RangingRequestCallback rangingRequestCallback,
+  RangingDispatchCallback rangingDispatchCallback,
+  RangingDropCallback rangingDropCallback)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  robotsRangingRequestCallbacks_.push_back(rangingRequestCallback);
+  robotsRangingDispatchCallbacks_.push_back(rangingDispatchCallback);
+  robotsRangingDropCallbacks_.push_back(rangingDropCallback);
+  robotsReachableResponders_.emplace_back();
+  robotsSlots_.push_back(0);
+  robotsPendingRequestsFlags_.push_back(0);
+  robotsPendingRequests_.push_back({robotsSlots_.size() - 1, 0, 0, Duration()});
+  robotsNumberOfDroppedRequests_.push_back(0);
+  dispatchedRequests_.reserve(robotsSlots_.size());
+  areSlotsOutdated_ = true;
+  return robotsSlots_.size() - 1;
+}
+
+//-----------------------------------------------------------------------------
+void RTLSChannelArbiter::updateRobotReachableResponders(
+  const size_t & robotIndex,
+  const std::vector<size_t> & respondersIndexes)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  assert(robotIndex < robotsReachableResponders_.size());
+  if (robotsReachableResponders_[robotIndex] != respondersIndexes) {
+    robotsReachableResponders_[robotIndex] = respondersIndexes;
+    areSlotsOutdated_ = true;
+  }
+}
+
+//-----------------------------------------------------------------------------
+RTLSChannelArbiter::RangingRequestCallback RTLSChannelArbiter::getRangingRequestCallback(
+  const size_t & robotIndex)
+{
+  return [this, robotIndex](
+    const size_t & initiatorIndex,
+    const size_t & responderIndex,
+    const Duration & timeout)
+    {
+      request_(robotIndex, initiatorIndex, responderIndex, timeout);
+    };
+}
+
+//-----------------------------------------------------------------------------
+void RTLSChannelArbiter::start()
+{
+  ticker_->start();
+}
+
+//-----------------------------------------------------------------------------
+void RTLSChannelArbiter::stop()
+{
+  ticker_->stop();
+}
+
+//-----------------------------------------------------------------------------
+size_t RTLSChannelArbiter::getNumberOfSlots()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  updateSlots_();
+  return numberOfSlots_;
+}
+
+//-----------------------------------------------------------------------------
+size_t RTLSChannelArbiter::getRobotSlot(const size_t & robotIndex)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  updateSlots_();
+  return robotsSlots_[robotIndex];
+}
+
+//-----------------------------------------------------------------------------
+size_t RTLSChannelArbiter::getNumberOfDroppedRequests(const size_t & robotIndex)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  assert(robotIndex < robotsNumberOfDroppedRequests_.size());
+  return robotsNumberOfDroppedRequests_[robotIndex];
+}
+
+//-----------------------------------------------------------------------------
+void RTLSChannelArbiter::request_(
+  const size_t & robotIndex,
+  const size_t & initiatorIndex,
+  const size_t & responderIndex,
+  const Duration & timeout)
+{
+  // only the last request of each robot is kept until its slot comes, the replaced one
+  // is reported outside the lock because drop callback may request again
+  RangingRequest droppedRequest{robotIndex, 0, 0, Duration()};
+  bool isRequestDropped = false;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (robotsPendingRequestsFlags_[robotIndex]) {
+      droppedRequest = robotsPendingRequests_[robotIndex];
+      ++robotsNumberOfDroppedRequests_[robotIndex];
+      isRequestDropped = true;
+    }
+    robotsPendingRequests_[robotIndex] = {robotIndex, initiatorIndex, responderIndex, timeout};
+    robotsPendingRequestsFlags_[robotIndex] = 1;
+  }
+
+  if (isRequestDropped && robotsRangingDropCallbacks_[robotIndex]) {
+    robotsRangingDropCallbacks_[robotIndex](
+      droppedRequest.initiatorIndex,
+      droppedRequest.responderIndex);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void RTLSChannelArbiter::timerCallback_()
+{
+  dispatchedRequests_.clear();
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    currentSlot_ = (currentSlot_ + 1) % numberOfSlots_;
+    if (currentSlot_ == 0) {
+      updateSlots_();
+    }
+
+    for (size_t n = 0; n < robotsSlots_.size(); ++n) {
+      if (robotsSlots_[n] == currentSlot_ && robotsPendingRequestsFlags_[n]) {
+        robotsPendingRequestsFlags_[n] = 0;
+        dispatchedRequests_.push_back(robotsPendingRequests_[n]);
+      }
+    }
+  }
+
+  // timeout is shortened to the slot, requester is told so together with dispatch stamp
+  for (const auto & request : dispatchedRequests_) {
+    Duration timeout = std::min(request.timeout, slotDuration_);
+    if (robotsRangingDispatchCallbacks_[request.robotIndex]) {
+      robotsRangingDispatchCallbacks_[request.robotIndex](
+        request.initiatorIndex,
+        request.responderIndex,
+        timeout);
+    }
+
+    robotsRangingRequestCallbacks_[request.robotIndex](
+      request.initiatorIndex,
+      request.responderIndex,
+      timeout);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void RTLSChannelArbiter::updateSlots_()
+{
+  if (areSlotsOutdated_) {
+    robotsSlots_ = assignSlots(robotsReachableResponders_);
+    numberOfSlots_ = 1;
+    for (const size_t & slot : robotsSlots_) {
+      numberOfSlots_ = std::max(numberOfSlots_, slot + 1);
+    }
+    currentSlot_ = currentSlot_ % numberOfSlots_;
+    areSlotsOutdated_ = false;
+  }
+}
+
+//-----------------------------------------------------------------------------
+std::vector<size_t> RTLSChannelArbiter::assignSlots(
+  const std::vector<std::vector<size_t>> & robotsReachableResponders)
+{
+  const size_t numberOfRobots = robotsReachableResponders.size();
+
+  // robots sharing at least one responder are in conflict
+  std::vector<std::vector<size_t>> respondersRobots;
+  for (size_t robotIndex = 0; robotIndex < numberOfRobots; ++robotIndex) {
+    for (const size_t & responderIndex : robotsReachableResponders[robotIndex]) {
+      if (responderIndex >= respondersRobots.size()) {
+        respondersRobots.resize(responderIndex + 1);
+      }
+      respondersRobots[responderIndex].push_back(robotIndex);
+    }
+  }
+
+  std::vector<std::vector<size_t>> conflicts(numberOfRobots);
+  for (const auto & robots : respondersRobots) {
+    for (size_t n = 0; n < robots.size(); ++n) {
+      for (size_t m = n + 1; m < robots.size(); ++m) {
+        conflicts[robots[n]].push_back(robots[m]);
+        conflicts[robots[m]].push_back(robots[n]);
+      }
+    }
+  }
+
+  for (auto & robots : conflicts) {
+    std::sort(robots.begin(), robots.end());
+    robots.erase(std::unique(robots.begin(), robots.end()), robots.end());
+  }
+
+  // Welsh-Powell greedy coloring: most constrained robots are colored first
+  // and take the smallest slot not used by their neighbors
+  std::vector<size_t> order(numberOfRobots);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](const size_t & a, const size_t & b) {
+      return conflicts[a].size() > conflicts[b].size();
+    });
+
+  const size_t unassigned = numberOfRobots;
+  std::vector<size_t> slots(numberOfRobots, unassigned);
+  std::vector<unsigned char> usedSlots(numberOfRobots + 1, 0);
+  for (const size_t & robotIndex : order) {
+    std::fill(usedSlots.begin(), usedSlots.end(), 0);
+    for (const size_t & neighborIndex : conflicts[robotIndex]) {
+      if (slots[neighborIndex] != unassigned) {
+        usedSlots[slots[neighborIndex]] = 1;
+      }
+    }
+
+    size_t slot = 0;
+    while (usedSlots[slot]) {
+      ++slot;
+    }
+    slots[robotIndex] = slot;
+  }
+
+  return slots;
+}
+
+}  // namespace core
+}  // namespace romea
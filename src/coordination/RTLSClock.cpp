@@ -0,0 +1,71 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <memory>
+
+// romea
+#include "romea_core_common/time/Timer.hpp"
+#include "romea_core_rtls/coordination/RTLSClock.hpp"
+
+namespace
+{
+
+class SystemTicker : public romea::core::RTLSTicker
+{
+public:
+  SystemTicker(
+    romea::core::RTLSClock::TickCallback tickCallback,
+    const romea::core::Duration & period)
+  : timer_(tickCallback, period)
+  {
+  }
+
+  void start() override
+  {
+    timer_.start();
+  }
+
+  void stop() override
+  {
+    timer_.stop();
+  }
+
+private:
+  romea::core::Timer timer_;
+};
+
+}  // namespace
+
+namespace romea
+{
+namespace core
+{
+
+//-----------------------------------------------------------------------------
+TimePoint RTLSSystemClock::now() const
+{
+  return romea::core::now();
+}
+
+//-----------------------------------------------------------------------------
+std::unique_ptr<RTLSTicker> RTLSSystemClock::createTicker(
+  TickCallback tickCallback,
+  const Duration & period)
+{
+  return std::make_unique<SystemTicker>(tickCallback, period);
+}
+
+}  // namespace core
+}  // namespace romea
@@ -0,0 +1,183 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+// romea
+#include "romea_core_rtls/coordination/RTLSGDOPRespondersSelector.hpp"
+
+namespace
+{
+
+// trace of the inverse of a 2x2 symmetric information matrix, i.e. squared GDOP
+double squaredGDOP(const Eigen::Matrix2d & informationMatrix)
+{
+  double determinant = informationMatrix(0, 0) * informationMatrix(1, 1) -
+    informationMatrix(0, 1) * informationMatrix(1, 0);
+
+  if (determinant <= std::numeric_limits<double>::epsilon()) {
+    return std::numeric_limits<double>::infinity();
+  }
+
+  return informationMatrix.trace() / determinant;
+}
+
+}  // namespace
+
+namespace romea
+{
+namespace core
+{
+
+//-----------------------------------------------------------------------------
+RTLSGDOPRespondersSelector::RTLSGDOPRespondersSelector(
+  const VectorOfEigenVector3d & respondersPositions)
+: respondersPositions_(respondersPositions),
+  linesOfSight_(respondersPositions.size()),
+  selectedFlags_(respondersPositions.size(), 0),
+  selectedIndexes_()
+{
+  selectedIndexes_.reserve(respondersPositions.size());
+}
+
+//-----------------------------------------------------------------------------
+const std::vector<size_t> & RTLSGDOPRespondersSelector::select(
+  const Eigen::Vector3d & position,
+  const std::vector<size_t> & candidatesIndexes,
+  const size_t & numberOfSelectedResponders)
+{
+  selectedIndexes_.clear();
+
+  if (candidatesIndexes.size() <= numberOfSelectedResponders ||
+    numberOfSelectedResponders < 2)
+  {
+    selectedIndexes_.assign(
+      candidatesIndexes.begin(),
+      candidatesIndexes.begin() + std::min(candidatesIndexes.size(), numberOfSelectedResponders));
+    return selectedIndexes_;
+  }
+
+  for (const size_t & index : candidatesIndexes) {
+    linesOfSight_[index] = computeLineOfSight_(position, index);
+    selectedFlags_[index] = 0;
+  }
+
+  // best pair is searched exhaustively, remaining responders are then added
+  // greedily, each one minimizing GDOP of the current subset
+  Eigen::Matrix2d informationMatrix = Eigen::Matrix2d::Zero();
+  double bestSquaredGDOP = std::numeric_limits<double>::infinity();
+  size_t bestFirst = candidatesIndexes[0];
+  size_t bestSecond = candidatesIndexes[1];
+  for (size_t n = 0; n < candidatesIndexes.size(); ++n) {
+    const Eigen::Vector2d & first = linesOfSight_[candidatesIndexes[n]];
+    for (size_t m = n + 1; m < candidatesIndexes.size(); ++m) {
+      const Eigen::Vector2d & second = linesOfSight_[candidatesIndexes[m]];
+      Eigen::Matrix2d pairInformationMatrix =
+        first * first.transpose() + second * second.transpose();
+      double pairSquaredGDOP = squaredGDOP(pairInformationMatrix);
+      if (pairSquaredGDOP < bestSquaredGDOP) {
+        bestSquaredGDOP = pairSquaredGDOP;
+        bestFirst = candidatesIndexes[n];
+        bestSecond = candidatesIndexes[m];
+        informationMatrix = pairInformationMatrix;
+      }
+    }
+  }
+
+  if (!std::isfinite(bestSquaredGDOP)) {
+    informationMatrix = linesOfSight_[bestFirst] * linesOfSight_[bestFirst].transpose() +
+      linesOfSight_[bestSecond] * linesOfSight_[bestSecond].transpose();
+  }
+
+  selectedFlags_[bestFirst] = 1;
+  selectedFlags_[bestSecond] = 1;
+  selectedIndexes_.push_back(bestFirst);
+  selectedIndexes_.push_back(bestSecond);
+
+  while (selectedIndexes_.size() < numberOfSelectedResponders) {
+    double bestCandidateSquaredGDOP = std::numeric_limits<double>::infinity();
+    size_t bestCandidate = candidatesIndexes.size();
+    for (size_t n = 0; n < candidatesIndexes.size(); ++n) {
+      size_t index = candidatesIndexes[n];
+      if (selectedFlags_[index]) {
+        continue;
+      }
+
+      const Eigen::Vector2d & lineOfSight = linesOfSight_[index];
+      double candidateSquaredGDOP = squaredGDOP(
+        informationMatrix + lineOfSight * lineOfSight.transpose());
+      if (bestCandidate == candidatesIndexes.size() ||
+        candidateSquaredGDOP < bestCandidateSquaredGDOP)
+      {
+        bestCandidateSquaredGDOP = candidateSquaredGDOP;
+        bestCandidate = n;
+      }
+    }
+
+    size_t index = candidatesIndexes[bestCandidate];
+    informationMatrix += linesOfSight_[index] * linesOfSight_[index].transpose();
+    selectedFlags_[index] = 1;
+    selectedIndexes_.push_back(index);
+  }
+
+  std::sort(selectedIndexes_.begin(), selectedIndexes_.end());
+  return selectedIndexes_;
+}
+
+//-----------------------------------------------------------------------------
+void RTLSGDOPRespondersSelector::setResponderPosition(
+  const size_t & responderIndex,
+  const Eigen::Vector3d & position)
+{
+  if (responderIndex >= respondersPositions_.size()) {
+    respondersPositions_.resize(responderIndex + 1, position);
+    linesOfSight_.resize(responderIndex + 1);
+    selectedFlags_.resize(responderIndex + 1, 0);
+    selectedIndexes_.reserve(responderIndex + 1);
+  }
+  respondersPositions_[responderIndex] = position;
+}
+
+//-----------------------------------------------------------------------------
+double RTLSGDOPRespondersSelector::computeGDOP(
+  const Eigen::Vector3d & position,
+  const std::vector<size_t> & respondersIndexes) const
+{
+  Eigen::Matrix2d informationMatrix = Eigen::Matrix2d::Zero();
+  for (const size_t & index : respondersIndexes) {
+    Eigen::Vector2d lineOfSight = computeLineOfSight_(position, index);
+    informationMatrix += lineOfSight * lineOfSight.transpose();
+  }
+  return std::sqrt(squaredGDOP(informationMatrix));
+}
+
+//-----------------------------------------------------------------------------
+Eigen::Vector2d RTLSGDOPRespondersSelector::computeLineOfSight_(
+  const Eigen::Vector3d & position,
+  const size_t & responderIndex) const
+{
+  Eigen::Vector3d direction = position - respondersPositions_[responderIndex];
+  double range = direction.norm();
+  if (range < std::numeric_limits<double>::epsilon()) {
+    return Eigen::Vector2d::Zero();
+  }
+  return direction.head<2>() / range;
+}
+
+}  // namespace core
+}  // namespace romea
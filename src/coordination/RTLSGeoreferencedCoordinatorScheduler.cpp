@@ -52,25 +52,71 @@ RTLSGeoreferencedCoordinatorScheduler::RTLSGeoreferencedCoordinatorScheduler(
   const VectorOfEigenVector3d & initiatorsPositions,
   const std::vector<std::string> & respondersNames,
   const VectorOfEigenVector3d & respondersPositions,
-  RangingRequestCallback rangingRequestCallback)
+  RangingRequestCallback rangingRequestCallback,
+  const PollingMode & pollingMode,
+  std::shared_ptr<RTLSClock> clock)
 : RTLSSimpleCoordinatorScheduler(
     pollRate,
     initiatorsNames,
     respondersNames,
-    rangingRequestCallback),
+    rangingRequestCallback,
+    pollingMode,
+    clock),
+  lastRobotPosition_(),
   reachableResponders_(
     respondersPositions,
     researchRadius(maximalResearchDistance, initiatorsPositions)),
+  researchHysteresisDistance_(
+    0),
+  gdopRespondersSelector_(
+    respondersPositions),
+  maximalNumberOfSelectedResponders_(
+    0),
+  respondersUpdatesMutex_(),
+  pendingRespondersUpdates_(),
+  appliedRespondersUpdates_(),
+  hasPendingRespondersUpdates_(
+    false),
+  activeResponders_(
+    respondersNames.size(), 1),
   selectedRespondersIndexes_(
     respondersNames.size()),
   selectedRespondersPollIndex_(
-    respondersNames.size() - 1)
+    respondersNames.size() - 1),
+  publishedSelectedRespondersIndexes_(),
+  nearRespondersDistance_(0),
+  nearRespondersPollWeight_(1),
+  superframeRespondersIndexes_(),
+  superframeRespondersWeights_(),
+  respondersWeights_(),
+  uncertaintySource_(),
+  informationGainPairSelector_(nullptr),
+  informativeRespondersIndexes_()
 {
+  std::iota(selectedRespondersIndexes_.begin(), selectedRespondersIndexes_.end(), 0);
+  publishSelectedResponders_();
 }
 
 //-----------------------------------------------------------------------------
-void RTLSGeoreferencedCoordinatorScheduler::timerCallback_()
+void RTLSGeoreferencedCoordinatorScheduler::poll_()
 {
+  if (hasPendingRespondersUpdates_.load()) {
+    applyRespondersUpdates_();
+    selectResponders_();
+    selectedRespondersPollIndex_ = std::min(
+      selectedRespondersPollIndex_,
+      std::max<size_t>(selectedRespondersIndexes_.size(), 1) - 1);
+
+    if (isSuperframeEnabled_) {
+      buildSuperframe_();
+    }
+  }
+
+  if (isSuperframeEnabled_) {
+    pollSuperframe_();
+    return;
+  }
+
   if (selectedRespondersIndexes_.size() >= 2) {
     incrementPollIndexes_();
   }
@@ -79,12 +125,172 @@ void RTLSGeoreferencedCoordinatorScheduler::timerCallback_()
     selectResponders_();
   }
 
+  Eigen::Vector3d robotPosition;
+  if (informationGainPairSelector_ && isRobotPositionAvailable_(robotPosition)) {
+    pollMostInformativePair_(robotPosition);
+    return;
+  }
+
   if (selectedRespondersIndexes_.size() >= 2) {
-    respondersPollIndex_ = selectedRespondersIndexes_[selectedRespondersPollIndex_];
-    rangingRequestCallback_(initiatorsPollIndex_, respondersPollIndex_, timeout_);
+    size_t numberOfPolls = numberOfInitiators_ * selectedRespondersIndexes_.size();
+    while (!canPoll_(
+        initiatorsPollIndex_, selectedRespondersIndexes_[selectedRespondersPollIndex_]) &&
+      --numberOfPolls > 0)
+    {
+      incrementPollIndexes_();
+    }
+
+    if (numberOfPolls > 0) {
+      respondersPollIndex_ = selectedRespondersIndexes_[selectedRespondersPollIndex_];
+      request_(initiatorsPollIndex_, respondersPollIndex_);
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void RTLSGeoreferencedCoordinatorScheduler::pollMostInformativePair_(
+  const Eigen::Vector3d & robotPosition)
+{
+  // probes of unhealthy responders or pruned links do not compete on information gain
+  informativeRespondersIndexes_.clear();
+  for (const size_t & responderIndex : selectedRespondersIndexes_) {
+    if (!isResponderHealthy(responderIndex)) {
+      if (canPoll_(initiatorsPollIndex_, responderIndex)) {
+        respondersPollIndex_ = responderIndex;
+        request_(initiatorsPollIndex_, responderIndex);
+        return;
+      }
+      continue;
+    }
+
+    for (size_t initiatorIndex = 0; initiatorIndex < numberOfInitiators_; ++initiatorIndex) {
+      if (isLinkPruned(initiatorIndex, responderIndex) &&
+        canPoll_(initiatorIndex, responderIndex))
+      {
+        respondersPollIndex_ = responderIndex;
+        request_(initiatorIndex, responderIndex);
+        return;
+      }
+    }
+    informativeRespondersIndexes_.push_back(responderIndex);
+  }
+
+  size_t initiatorIndex = 0;
+  size_t responderIndex = 0;
+  informationGainPairSelector_->setCovariance(uncertaintySource_());
+  if (informationGainPairSelector_->select(
+      robotPosition, informativeRespondersIndexes_, clock_->now(),
+      initiatorIndex, responderIndex,
+      [this](const size_t & candidateInitiatorIndex, const size_t & candidateResponderIndex) {
+        return !isLinkPruned(candidateInitiatorIndex, candidateResponderIndex);
+      }))
+  {
+    respondersPollIndex_ = responderIndex;
+    request_(initiatorIndex, responderIndex);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void RTLSGeoreferencedCoordinatorScheduler::enableInformationGainPolling(
+  UncertaintySource uncertaintySource,
+  const double & rangeStd,
+  const Duration & maximalLinkAge)
+{
+  VectorOfEigenVector3d respondersPositions;
+  for (size_t n = 0; n < numberOfResponders_; ++n) {
+    respondersPositions.push_back(reachableResponders_.getPoint(n));
+  }
+
+  uncertaintySource_ = uncertaintySource;
+  informationGainPairSelector_ = std::make_unique<RTLSInformationGainPairSelector>(
+    numberOfInitiators_,
+    respondersPositions,
+    rangeStd,
+    maximalLinkAge);
+}
+
+//-----------------------------------------------------------------------------
+void RTLSGeoreferencedCoordinatorScheduler::disableInformationGainPolling()
+{
+  informationGainPairSelector_.reset();
+  uncertaintySource_ = nullptr;
+}
+
+//-----------------------------------------------------------------------------
+bool RTLSGeoreferencedCoordinatorScheduler::isRobotPositionAvailable_(
+  Eigen::Vector3d & robotPosition) const
+{
+  RobotPosition lastRobotPosition = lastRobotPosition_.load();
+  if (duration(clock_->now(), lastRobotPosition.stamp) >= durationFromSecond(1)) {
+    return false;
+  }
+
+  robotPosition = Eigen::Vector3d(
+    lastRobotPosition.position[0],
+    lastRobotPosition.position[1],
+    lastRobotPosition.position[2]);
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+void RTLSGeoreferencedCoordinatorScheduler::startSuperframe_()
+{
+  selectResponders_();
+  computeRespondersWeights_(respondersWeights_);
+  if (selectedRespondersIndexes_ != superframeRespondersIndexes_ ||
+    respondersWeights_ != superframeRespondersWeights_)
+  {
+    buildSuperframe_();
+  }
+}
+
+//-----------------------------------------------------------------------------
+void RTLSGeoreferencedCoordinatorScheduler::buildSuperframe_()
+{
+  superframeRespondersIndexes_ = selectedRespondersIndexes_;
+  computeRespondersWeights_(superframeRespondersWeights_);
+
+  if (superframeRespondersIndexes_.size() >= 2) {
+    superframe_.build(
+      numberOfInitiators_,
+      superframeRespondersIndexes_,
+      superframeRespondersWeights_);
+  } else {
+    superframe_.clear();
+  }
+}
+
+//-----------------------------------------------------------------------------
+void RTLSGeoreferencedCoordinatorScheduler::computeRespondersWeights_(
+  std::vector<size_t> & respondersWeights)
+{
+  respondersWeights.assign(selectedRespondersIndexes_.size(), 1);
+  if (nearRespondersPollWeight_ == 1) {
+    return;
+  }
+
+  Eigen::Vector3d robotPosition;
+  if (!isRobotPositionAvailable_(robotPosition)) {
+    return;
+  }
+
+  for (size_t n = 0; n < selectedRespondersIndexes_.size(); ++n) {
+    const auto & responderPosition = reachableResponders_.getPoint(selectedRespondersIndexes_[n]);
+    if ((responderPosition - robotPosition).norm() <= nearRespondersDistance_) {
+      respondersWeights[n] = nearRespondersPollWeight_;
+    }
   }
 }
 
+//-----------------------------------------------------------------------------
+void RTLSGeoreferencedCoordinatorScheduler::setNearRespondersPollWeight(
+  const double & distance,
+  const size_t & weight)
+{
+  nearRespondersDistance_ = distance;
+  nearRespondersPollWeight_ = weight;
+}
+
 //-----------------------------------------------------------------------------
 void RTLSGeoreferencedCoordinatorScheduler::incrementPollIndexes_()
 {
@@ -104,43 +310,158 @@ void RTLSGeoreferencedCoordinatorScheduler::incrementPollIndexes_()
 //-----------------------------------------------------------------------------
 void RTLSGeoreferencedCoordinatorScheduler::selectResponders_()
 {
-  std::lock_guard<std::mutex> lock(mutex_);
-  if (duration(now(), lastRobotPositionStamp_) < durationFromSecond(1)) {
-    selectedRespondersIndexes_ = reachableResponders_.find(lastRobotPosition_);
+  size_t maximalNumberOfSelectedResponders = maximalNumberOfSelectedResponders_.load();
+
+  Eigen::Vector3d robotPosition;
+  if (isRobotPositionAvailable_(robotPosition)) {
+    reachableResponders_.setHysteresisDistance(researchHysteresisDistance_.load());
+    const auto & reachableRespondersIndexes = reachableResponders_.find(robotPosition);
+    if (maximalNumberOfSelectedResponders != 0 &&
+      reachableRespondersIndexes.size() > maximalNumberOfSelectedResponders)
+    {
+      selectedRespondersIndexes_ = gdopRespondersSelector_.select(
+        robotPosition, reachableRespondersIndexes, maximalNumberOfSelectedResponders);
+    } else {
+      selectedRespondersIndexes_ = reachableRespondersIndexes;
+    }
   } else {
-    selectedRespondersIndexes_.resize(numberOfResponders_);
-    std::iota(selectedRespondersIndexes_.begin(), selectedRespondersIndexes_.end(), 0);
+    selectedRespondersIndexes_.clear();
+    for (size_t n = 0; n < numberOfResponders_; ++n) {
+      if (activeResponders_[n]) {
+        selectedRespondersIndexes_.push_back(n);
+      }
+    }
   }
+
+  publishSelectedResponders_();
+}
+
+//-----------------------------------------------------------------------------
+void RTLSGeoreferencedCoordinatorScheduler::publishSelectedResponders_()
+{
+  auto selectedRespondersIndexes =
+    std::make_shared<const std::vector<size_t>>(selectedRespondersIndexes_);
+  std::atomic_store(&publishedSelectedRespondersIndexes_, std::move(selectedRespondersIndexes));
+}
+
+//-----------------------------------------------------------------------------
+std::shared_ptr<const std::vector<size_t>>
+RTLSGeoreferencedCoordinatorScheduler::loadSelectedResponders_() const
+{
+  return std::atomic_load(&publishedSelectedRespondersIndexes_);
 }
 
 //-----------------------------------------------------------------------------
 void RTLSGeoreferencedCoordinatorScheduler::updateRobotPosition(
   const Eigen::Vector3d & robotPosition)
 {
-  std::lock_guard<std::mutex> lock(mutex_);
-  lastRobotPosition_ = robotPosition;
-  lastRobotPositionStamp_ = now();
+  lastRobotPosition_.store(
+    {{robotPosition.x(), robotPosition.y(), robotPosition.z()}, clock_->now()});
 }
 
 //-----------------------------------------------------------------------------
-const std::vector<size_t> RTLSGeoreferencedCoordinatorScheduler::getSelectedRespondersIndexes()
+void RTLSGeoreferencedCoordinatorScheduler::setMaximalNumberOfSelectedResponders(
+  const size_t & maximalNumberOfSelectedResponders)
 {
-  return selectedRespondersIndexes_;
+  maximalNumberOfSelectedResponders_.store(maximalNumberOfSelectedResponders);
 }
 
 //-----------------------------------------------------------------------------
-DiagnosticReport RTLSGeoreferencedCoordinatorScheduler::getReport()
+void RTLSGeoreferencedCoordinatorScheduler::setResearchHysteresisDistance(
+  const double & hysteresisDistance)
 {
-  DiagnosticReport report;
-  for (size_t i = 0; i < numberOfInitiators_; ++i) {
-    report += diagnostics_.getInitiatorReport(i);
+  researchHysteresisDistance_.store(hysteresisDistance);
+}
+
+//-----------------------------------------------------------------------------
+size_t RTLSGeoreferencedCoordinatorScheduler::addResponder(
+  const std::string & responderName,
+  const Eigen::Vector3d & position)
+{
+  std::lock_guard<std::mutex> lock(respondersUpdatesMutex_);
+  size_t responderIndex = diagnostics_.addResponder(responderName);
+  pendingRespondersUpdates_.push_back({RespondersUpdateType::ADD, responderIndex, position});
+  hasPendingRespondersUpdates_.store(true);
+  return responderIndex;
+}
+
+//-----------------------------------------------------------------------------
+void RTLSGeoreferencedCoordinatorScheduler::removeResponder(const size_t & responderIndex)
+{
+  std::lock_guard<std::mutex> lock(respondersUpdatesMutex_);
+  pendingRespondersUpdates_.push_back(
+    {RespondersUpdateType::REMOVE, responderIndex, Eigen::Vector3d::Zero()});
+  hasPendingRespondersUpdates_.store(true);
+}
+
+//-----------------------------------------------------------------------------
+void RTLSGeoreferencedCoordinatorScheduler::updateResponderPosition(
+  const size_t & responderIndex,
+  const Eigen::Vector3d & position)
+{
+  std::lock_guard<std::mutex> lock(respondersUpdatesMutex_);
+  pendingRespondersUpdates_.push_back({RespondersUpdateType::MOVE, responderIndex, position});
+  hasPendingRespondersUpdates_.store(true);
+}
+
+//-----------------------------------------------------------------------------
+void RTLSGeoreferencedCoordinatorScheduler::applyRespondersUpdates_()
+{
+  {
+    std::lock_guard<std::mutex> lock(respondersUpdatesMutex_);
+    std::swap(pendingRespondersUpdates_, appliedRespondersUpdates_);
+    hasPendingRespondersUpdates_.store(false);
   }
 
-  for (size_t i = 0; i < selectedRespondersIndexes_.size(); ++i) {
-    report += diagnostics_.getResponderReport(selectedRespondersIndexes_[i]);
+  for (const auto & update : appliedRespondersUpdates_) {
+    switch (update.type) {
+      case RespondersUpdateType::ADD:
+        reachableResponders_.add(update.position);
+        gdopRespondersSelector_.setResponderPosition(update.responderIndex, update.position);
+        activeResponders_.push_back(1);
+        numberOfResponders_ = activeResponders_.size();
+        if (linksLatencies_) {
+          linksLatencies_->addResponder();
+        }
+        if (respondersHealth_) {
+          respondersHealth_->addResponder();
+        }
+        if (linksHealth_) {
+          linksHealth_->addResponder();
+        }
+        if (informationGainPairSelector_) {
+          informationGainPairSelector_->setResponderPosition(
+            update.responderIndex, update.position);
+        }
+        assert(update.responderIndex + 1 == numberOfResponders_);
+        break;
+      case RespondersUpdateType::REMOVE:
+        reachableResponders_.remove(update.responderIndex);
+        activeResponders_[update.responderIndex] = 0;
+        break;
+      case RespondersUpdateType::MOVE:
+        reachableResponders_.update(update.responderIndex, update.position);
+        gdopRespondersSelector_.setResponderPosition(update.responderIndex, update.position);
+        if (informationGainPairSelector_) {
+          informationGainPairSelector_->setResponderPosition(
+            update.responderIndex, update.position);
+        }
+        break;
+    }
   }
+  appliedRespondersUpdates_.clear();
+}
 
-  return report;
+//-----------------------------------------------------------------------------
+const std::vector<size_t> RTLSGeoreferencedCoordinatorScheduler::getSelectedRespondersIndexes()
+{
+  return *loadSelectedResponders_();
+}
+
+//-----------------------------------------------------------------------------
+DiagnosticReport RTLSGeoreferencedCoordinatorScheduler::getReport()
+{
+  return diagnostics_.getReport(*loadSelectedResponders_());
 }
 
 }  // namespace core
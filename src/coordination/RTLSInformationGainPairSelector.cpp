@@ -0,0 +1,176 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <cassert>
+#include <limits>
+#include <vector>
+
+// romea
+#include "romea_core_rtls/coordination/RTLSInformationGainPairSelector.hpp"
+
+namespace romea
+{
+namespace core
+{
+
+//-----------------------------------------------------------------------------
+RTLSInformationGainPairSelector::RTLSInformationGainPairSelector(
+  const size_t & numberOfInitiators,
+  const VectorOfEigenVector3d & respondersPositions,
+  const double & rangeStd,
+  const Duration & maximalLinkAge)
+: numberOfInitiators_(numberOfInitiators),
+  respondersPositions_(respondersPositions),
+  rangeVariance_(rangeStd * rangeStd),
+  maximalLinkAge_(maximalLinkAge),
+  sourceCovariance_(Eigen::Matrix2d::Identity()),
+  covariance_(Eigen::Matrix2d::Identity()),
+  lastSelectionStamps_(numberOfInitiators * respondersPositions.size(), TimePoint::min())
+{
+  assert(rangeStd > 0);
+}
+
+//-----------------------------------------------------------------------------
+void RTLSInformationGainPairSelector::setResponderPosition(
+  const size_t & responderIndex,
+  const Eigen::Vector3d & position)
+{
+  if (responderIndex >= respondersPositions_.size()) {
+    respondersPositions_.resize(responderIndex + 1, position);
+    lastSelectionStamps_.resize(numberOfInitiators_ * (responderIndex + 1), TimePoint::min());
+  }
+  respondersPositions_[responderIndex] = position;
+}
+
+//-----------------------------------------------------------------------------
+void RTLSInformationGainPairSelector::setCovariance(const Eigen::Matrix2d & covariance)
+{
+  if (covariance != sourceCovariance_) {
+    sourceCovariance_ = covariance;
+    covariance_ = covariance;
+  }
+}
+
+//-----------------------------------------------------------------------------
+const Eigen::Matrix2d & RTLSInformationGainPairSelector::getCovariance() const
+{
+  return covariance_;
+}
+
+//-----------------------------------------------------------------------------
+bool RTLSInformationGainPairSelector::select(
+  const Eigen::Vector3d & position,
+  const std::vector<size_t> & candidatesIndexes,
+  const TimePoint & stamp,
+  size_t & initiatorIndex,
+  size_t & responderIndex,
+  const LinkFilter & isLinkSelectable)
+{
+  // stalest link is used as tie break and overrides information gain when too old
+  bool isSelected = false;
+  double bestTraceReduction = -std::numeric_limits<double>::infinity();
+  TimePoint stalestStamp = TimePoint::max();
+  size_t stalestInitiatorIndex = 0;
+  size_t stalestResponderIndex = 0;
+  for (const size_t & index : candidatesIndexes) {
+    // links rejected by filter are not selected, nor their responder when all are rejected
+    size_t oldestInitiatorIndex = numberOfInitiators_;
+    for (size_t i = 0; i < numberOfInitiators_; ++i) {
+      if ((!isLinkSelectable || isLinkSelectable(i, index)) &&
+        (oldestInitiatorIndex == numberOfInitiators_ ||
+        lastSelectionStamp_(i, index) < lastSelectionStamp_(oldestInitiatorIndex, index)))
+      {
+        oldestInitiatorIndex = i;
+      }
+    }
+
+    if (oldestInitiatorIndex == numberOfInitiators_) {
+      continue;
+    }
+    isSelected = true;
+
+    const TimePoint & oldestStamp = lastSelectionStamp_(oldestInitiatorIndex, index);
+    if (oldestStamp < stalestStamp) {
+      stalestStamp = oldestStamp;
+      stalestInitiatorIndex = oldestInitiatorIndex;
+      stalestResponderIndex = index;
+    }
+
+    double traceReduction = computeTraceReduction(position, index);
+    if (traceReduction > bestTraceReduction) {
+      bestTraceReduction = traceReduction;
+      initiatorIndex = oldestInitiatorIndex;
+      responderIndex = index;
+    }
+  }
+
+  if (!isSelected) {
+    return false;
+  }
+
+  if (stalestStamp < stamp - maximalLinkAge_) {
+    initiatorIndex = stalestInitiatorIndex;
+    responderIndex = stalestResponderIndex;
+  }
+
+  lastSelectionStamp_(initiatorIndex, responderIndex) = stamp;
+  update_(computeLineOfSight_(position, responderIndex));
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+double RTLSInformationGainPairSelector::computeTraceReduction(
+  const Eigen::Vector3d & position,
+  const size_t & responderIndex) const
+{
+  // trace(P) - trace(P') where P' is P updated by a range along line of sight u:
+  // u' P^2 u / (u' P u + sigma^2)
+  Eigen::Vector2d lineOfSight = computeLineOfSight_(position, responderIndex);
+  Eigen::Vector2d covarianceLineOfSight = covariance_ * lineOfSight;
+  return covarianceLineOfSight.squaredNorm() /
+         (lineOfSight.dot(covarianceLineOfSight) + rangeVariance_);
+}
+
+//-----------------------------------------------------------------------------
+void RTLSInformationGainPairSelector::update_(const Eigen::Vector2d & lineOfSight)
+{
+  Eigen::Vector2d covarianceLineOfSight = covariance_ * lineOfSight;
+  covariance_ -= covarianceLineOfSight * covarianceLineOfSight.transpose() /
+    (lineOfSight.dot(covarianceLineOfSight) + rangeVariance_);
+}
+
+//-----------------------------------------------------------------------------
+TimePoint & RTLSInformationGainPairSelector::lastSelectionStamp_(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex)
+{
+  return lastSelectionStamps_[responderIndex * numberOfInitiators_ + initiatorIndex];
+}
+
+//-----------------------------------------------------------------------------
+Eigen::Vector2d RTLSInformationGainPairSelector::computeLineOfSight_(
+  const Eigen::Vector3d & position,
+  const size_t & responderIndex) const
+{
+  Eigen::Vector3d direction = position - respondersPositions_[responderIndex];
+  double range = direction.norm();
+  if (range < std::numeric_limits<double>::epsilon()) {
+    return Eigen::Vector2d::Zero();
+  }
+  return direction.head<2>() / range;
+}
+
+}  // namespace core
+}  // namespace romea
@@ -0,0 +1,131 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <cassert>
+#include <mutex>
+
+// romea
+#include "romea_core_rtls/coordination/RTLSLinksHealth.hpp"
+
+namespace romea
+{
+namespace core
+{
+
+//-----------------------------------------------------------------------------
+RTLSLinksHealth::RTLSLinksHealth(
+  const size_t & numberOfInitiators,
+  const size_t & numberOfResponders,
+  const double & minimalQuality,
+  const Duration & minimalProbePeriod,
+  const Duration & maximalProbePeriod)
+: mutex_(),
+  numberOfInitiators_(numberOfInitiators),
+  numberOfResponders_(numberOfResponders),
+  minimalQuality_(minimalQuality),
+  backoff_(numberOfInitiators * numberOfResponders, minimalProbePeriod, maximalProbePeriod)
+{
+}
+
+//-----------------------------------------------------------------------------
+size_t RTLSLinksHealth::linkIndex_(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex) const
+{
+  // responder major so that new responders are appended
+  assert(initiatorIndex < numberOfInitiators_);
+  assert(responderIndex < numberOfResponders_);
+  return responderIndex * numberOfInitiators_ + initiatorIndex;
+}
+
+//-----------------------------------------------------------------------------
+bool RTLSLinksHealth::canPoll(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex,
+  const TimePoint & stamp)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return backoff_.canPoll(linkIndex_(initiatorIndex, responderIndex), stamp);
+}
+
+//-----------------------------------------------------------------------------
+void RTLSLinksHealth::commitProbe(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex,
+  const TimePoint & stamp)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  backoff_.commitProbe(linkIndex_(initiatorIndex, responderIndex), stamp);
+}
+
+//-----------------------------------------------------------------------------
+void RTLSLinksHealth::feedback(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex,
+  const TimePoint & stamp,
+  const bool & isSuccessful,
+  const double & quality)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  backoff_.feedback(
+    linkIndex_(initiatorIndex, responderIndex), stamp, isSuccessful, quality >= minimalQuality_);
+}
+
+//-----------------------------------------------------------------------------
+bool RTLSLinksHealth::isPruned(const size_t & initiatorIndex, const size_t & responderIndex)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return backoff_.isExcluded(linkIndex_(initiatorIndex, responderIndex));
+}
+
+//-----------------------------------------------------------------------------
+Duration RTLSLinksHealth::getProbePeriod(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return backoff_.getProbePeriod(linkIndex_(initiatorIndex, responderIndex));
+}
+
+//-----------------------------------------------------------------------------
+const double & RTLSLinksHealth::getMinimalQuality() const
+{
+  return minimalQuality_;
+}
+
+//-----------------------------------------------------------------------------
+size_t RTLSLinksHealth::getNumberOfPrunedLinks()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return backoff_.getNumberOfExcludedEntities();
+}
+
+//-----------------------------------------------------------------------------
+size_t RTLSLinksHealth::getNumberOfProbes()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return backoff_.getNumberOfProbes();
+}
+
+//-----------------------------------------------------------------------------
+void RTLSLinksHealth::addResponder()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  backoff_.addEntities(numberOfInitiators_);
+  ++numberOfResponders_;
+}
+
+}  // namespace core
+}  // namespace romea
@@ -0,0 +1,167 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+// romea
+#include "romea_core_rtls/coordination/RTLSLinksLatencies.hpp"
+
+namespace
+{
+const double SCALE_SMOOTHING = 0.05;
+const double QUANTILE_LEARNING_RATE = 0.5;
+const size_t MINIMAL_NUMBER_OF_SAMPLES = 10;
+}
+
+namespace romea
+{
+namespace core
+{
+
+//-----------------------------------------------------------------------------
+RTLSLinksLatencies::RTLSLinksLatencies(
+  const size_t & numberOfInitiators,
+  const size_t & numberOfResponders,
+  const double & quantile,
+  const double & timeoutMargin,
+  const Duration & minimalTimeout)
+: mutex_(),
+  numberOfInitiators_(numberOfInitiators),
+  numberOfResponders_(numberOfResponders),
+  quantile_(quantile),
+  timeoutMargin_(timeoutMargin),
+  minimalTimeout_(minimalTimeout),
+  links_(numberOfInitiators * numberOfResponders, Link{TimePoint(), false, 0, 0, 0})
+{
+}
+
+//-----------------------------------------------------------------------------
+void RTLSLinksLatencies::request(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex,
+  const TimePoint & stamp)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  Link & link = link_(initiatorIndex, responderIndex);
+  link.requestStamp = stamp;
+  link.isRequestPending = true;
+}
+
+//-----------------------------------------------------------------------------
+void RTLSLinksLatencies::feedback(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex,
+  const TimePoint & stamp,
+  const bool & isSuccessful,
+  const TimePoint & requestStamp)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  Link & link = link_(initiatorIndex, responderIndex);
+  if (requestStamp < link.requestStamp) {
+    return;
+  }
+
+
+  // failed exchanges last until timeout, they tell nothing about link latency
+  if (link.isRequestPending && isSuccessful) {
+    update_(link, durationToSecond(duration(stamp, link.requestStamp)));
+  }
+  link.isRequestPending = false;
+}
+
+//-----------------------------------------------------------------------------
+void RTLSLinksLatencies::update(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex,
+  const double & latency)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  update_(link_(initiatorIndex, responderIndex), latency);
+}
+
+//-----------------------------------------------------------------------------
+double RTLSLinksLatencies::getLatencyQuantile(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return link_(initiatorIndex, responderIndex).quantile;
+}
+
+//-----------------------------------------------------------------------------
+Duration RTLSLinksLatencies::computeTimeout(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex,
+  const Duration & maximalTimeout)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  const Link & link = link_(initiatorIndex, responderIndex);
+  if (link.numberOfSamples < MINIMAL_NUMBER_OF_SAMPLES) {
+    return maximalTimeout;
+  }
+
+  Duration timeout = durationFromSecond(timeoutMargin_ * link.quantile);
+  return std::min(std::max(timeout, minimalTimeout_), maximalTimeout);
+}
+
+//-----------------------------------------------------------------------------
+void RTLSLinksLatencies::addResponder()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::vector<Link> links(
+    numberOfInitiators_ * (numberOfResponders_ + 1), Link{TimePoint(), false, 0, 0, 0});
+  for (size_t i = 0; i < numberOfInitiators_; ++i) {
+    std::copy_n(
+      links_.begin() + i * numberOfResponders_, numberOfResponders_,
+      links.begin() + i * (numberOfResponders_ + 1));
+  }
+  links_.swap(links);
+  ++numberOfResponders_;
+}
+
+//-----------------------------------------------------------------------------
+RTLSLinksLatencies::Link & RTLSLinksLatencies::link_(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex)
+{
+  assert(initiatorIndex < numberOfInitiators_);
+  assert(responderIndex < numberOfResponders_);
+  return links_[initiatorIndex * numberOfResponders_ + responderIndex];
+}
+
+//-----------------------------------------------------------------------------
+void RTLSLinksLatencies::update_(Link & link, const double & latency)
+{
+  if (link.numberOfSamples++ == 0) {
+    link.quantile = latency;
+    link.scale = latency / 2;
+    return;
+  }
+
+  // stochastic approximation of the quantile, steps are scaled by a running
+  // mean absolute deviation so it adapts to the latency range of each link
+  link.scale += SCALE_SMOOTHING * (std::abs(latency - link.quantile) - link.scale);
+  if (latency > link.quantile) {
+    link.quantile += QUANTILE_LEARNING_RATE * link.scale * quantile_;
+  } else {
+    link.quantile -= QUANTILE_LEARNING_RATE * link.scale * (1 - quantile_);
+  }
+}
+
+}  // namespace core
+}  // namespace romea
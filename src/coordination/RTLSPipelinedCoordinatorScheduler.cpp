@@ -0,0 +1,227 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <algorithm>
+#include <string>
+#include <vector>
+
+// romea
+#include "romea_core_rtls/coordination/RTLSPipelinedCoordinatorScheduler.hpp"
+
+namespace romea
+{
+namespace core
+{
+
+//-----------------------------------------------------------------------------
+RTLSPipelinedCoordinatorScheduler::RTLSPipelinedCoordinatorScheduler(
+  const double & pollRate,
+  const std::vector<std::string> & initiatorsNames,
+  const std::vector<std::string> & respondersNames,
+  RangingRequestCallback rangingRequestCallback,
+  std::shared_ptr<RTLSClock> clock)
+: RTLSSimpleCoordinatorScheduler(
+    pollRate,
+    initiatorsNames,
+    respondersNames,
+    rangingRequestCallback,
+    PollingMode::COMPLETION,
+    clock),
+  busyInitiators_(initiatorsNames.size(), 0),
+  busyResponders_(respondersNames.size(), 0),
+  initiatorsRespondersPollIndexes_(initiatorsNames.size(), respondersNames.size() - 1),
+  inFlightRequests_(),
+  dispatchedRequests_()
+{
+  inFlightRequests_.reserve(std::min(numberOfInitiators_, numberOfResponders_));
+  dispatchedRequests_.reserve(std::min(numberOfInitiators_, numberOfResponders_));
+}
+
+//-----------------------------------------------------------------------------
+void RTLSPipelinedCoordinatorScheduler::timerCallback_()
+{
+  {
+    std::lock_guard<std::mutex> lock(pollMutex_);
+    TimePoint stamp = clock_->now();
+    for (size_t n = inFlightRequests_.size(); n-- > 0; ) {
+      if (stamp > inFlightRequests_[n].deadline) {
+        release_(n);
+      }
+    }
+  }
+
+  pollNext_();
+}
+
+//-----------------------------------------------------------------------------
+void RTLSPipelinedCoordinatorScheduler::poll_()
+{
+  dispatchedRequests_.clear();
+
+  if (!isSuperframeEnabled_) {
+    std::lock_guard<std::mutex> lock(pollMutex_);
+    pollFreeResponders_(clock_->now());
+  } else if (pollSuperframeSlots_()) {
+    // current frame ended before every initiator was busy, next one is started
+    pollSuperframeSlots_();
+  }
+
+  for (const auto & request : dispatchedRequests_) {
+    commitProbes_(request.initiatorIndex, request.responderIndex, request.stamp);
+    if (linksLatencies_) {
+      linksLatencies_->request(
+        request.initiatorIndex, request.responderIndex, request.stamp);
+    }
+    rangingRequestCallback_(request.initiatorIndex, request.responderIndex, request.timeout);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void RTLSPipelinedCoordinatorScheduler::pollFreeResponders_(const TimePoint & stamp)
+{
+  // initiators are visited in turn so that none of them always gets the first free responder
+  initiatorsPollIndex_ = (initiatorsPollIndex_ + 1) % numberOfInitiators_;
+  for (size_t n = 0; n < numberOfInitiators_; ++n) {
+    size_t initiatorIndex = (initiatorsPollIndex_ + n) % numberOfInitiators_;
+    if (busyInitiators_[initiatorIndex]) {
+      continue;
+    }
+
+    size_t & responderPollIndex = initiatorsRespondersPollIndexes_[initiatorIndex];
+    for (size_t m = 1; m <= numberOfResponders_; ++m) {
+      size_t responderIndex = (responderPollIndex + m) % numberOfResponders_;
+      if (!busyResponders_[responderIndex] && canPoll_(initiatorIndex, responderIndex)) {
+        responderPollIndex = responderIndex;
+        addInFlightRequest_(initiatorIndex, responderIndex, stamp);
+        break;
+      }
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+bool RTLSPipelinedCoordinatorScheduler::pollSuperframeSlots_()
+{
+  if (superframe_.isAtFrameStart()) {
+    startSuperframe_();
+  }
+
+  // slots are read in superframe order until every initiator is busy, slots whose
+  // transceivers are still busy or whose responder is unhealthy wait for the next frame
+  std::lock_guard<std::mutex> lock(pollMutex_);
+  TimePoint stamp = clock_->now();
+  for (size_t n = 0; n < superframe_.size(); ++n) {
+    if (std::find(busyInitiators_.begin(), busyInitiators_.end(), 0) == busyInitiators_.end()) {
+      return false;
+    }
+
+    const auto & slot = superframe_.next();
+    if (!busyInitiators_[slot.initiatorIndex] &&
+      !busyResponders_[slot.responderIndex] &&
+      canPoll_(slot.initiatorIndex, slot.responderIndex))
+    {
+      initiatorsPollIndex_ = slot.initiatorIndex;
+      respondersPollIndex_ = slot.responderIndex;
+      addInFlightRequest_(slot.initiatorIndex, slot.responderIndex, stamp);
+    }
+
+    if (superframe_.isAtFrameStart()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+//-----------------------------------------------------------------------------
+void RTLSPipelinedCoordinatorScheduler::addInFlightRequest_(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex,
+  const TimePoint & stamp)
+{
+  busyInitiators_[initiatorIndex] = 1;
+  busyResponders_[responderIndex] = 1;
+  Duration timeout = getTimeout(initiatorIndex, responderIndex);
+  inFlightRequests_.push_back({initiatorIndex, responderIndex, stamp, timeout, stamp + timeout});
+  dispatchedRequests_.push_back(inFlightRequests_.back());
+}
+
+//-----------------------------------------------------------------------------
+void RTLSPipelinedCoordinatorScheduler::dispatch(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex,
+  const Duration & timeout)
+{
+  TimePoint stamp = clock_->now();
+
+  bool isDispatched = false;
+
+  {
+    std::lock_guard<std::mutex> lock(pollMutex_);
+    for (auto & inFlightRequest : inFlightRequests_) {
+      if (inFlightRequest.initiatorIndex == initiatorIndex &&
+        inFlightRequest.responderIndex == responderIndex)
+      {
+        inFlightRequest.stamp = stamp;
+        inFlightRequest.timeout = timeout;
+        inFlightRequest.deadline = stamp + timeout;
+        isDispatched = true;
+        break;
+      }
+    }
+  }
+
+  if (isDispatched && linksLatencies_) {
+    linksLatencies_->request(initiatorIndex, responderIndex, stamp);
+  }
+}
+
+//-----------------------------------------------------------------------------
+bool RTLSPipelinedCoordinatorScheduler::completeRequest_(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex,
+  const TimePoint & requestStamp)
+{
+  std::lock_guard<std::mutex> lock(pollMutex_);
+  for (size_t n = 0; n < inFlightRequests_.size(); ++n) {
+    if (inFlightRequests_[n].initiatorIndex == initiatorIndex &&
+      inFlightRequests_[n].responderIndex == responderIndex &&
+      requestStamp >= inFlightRequests_[n].stamp)
+    {
+      release_(n);
+      return true;
+    }
+  }
+  return false;
+}
+
+//-----------------------------------------------------------------------------
+void RTLSPipelinedCoordinatorScheduler::release_(const size_t & inFlightRequestIndex)
+{
+  const InFlightRequest & request = inFlightRequests_[inFlightRequestIndex];
+  busyInitiators_[request.initiatorIndex] = 0;
+  busyResponders_[request.responderIndex] = 0;
+  inFlightRequests_[inFlightRequestIndex] = inFlightRequests_.back();
+  inFlightRequests_.pop_back();
+}
+
+//-----------------------------------------------------------------------------
+size_t RTLSPipelinedCoordinatorScheduler::getNumberOfInFlightRequests()
+{
+  std::lock_guard<std::mutex> lock(pollMutex_);
+  return inFlightRequests_.size();
+}
+
+}  // namespace core
+}  // namespace romea
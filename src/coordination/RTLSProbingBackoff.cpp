@@ -0,0 +1,130 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+// romea
+#include "romea_core_rtls/coordination/RTLSProbingBackoff.hpp"
+
+namespace
+{
+const size_t MINIMAL_NUMBER_OF_CONSECUTIVE_FAILURES = 3;
+}
+
+namespace romea
+{
+namespace core
+{
+
+//-----------------------------------------------------------------------------
+RTLSProbingBackoff::RTLSProbingBackoff(
+  const size_t & numberOfEntities,
+  const Duration & minimalProbePeriod,
+  const Duration & maximalProbePeriod)
+: minimalProbePeriod_(minimalProbePeriod),
+  maximalProbePeriod_(maximalProbePeriod),
+  entities_(numberOfEntities, Entity{false, 0, minimalProbePeriod, TimePoint()}),
+  numberOfExcludedEntities_(0),
+  numberOfProbes_(0)
+{
+  assert(minimalProbePeriod <= maximalProbePeriod);
+}
+
+//-----------------------------------------------------------------------------
+bool RTLSProbingBackoff::canPoll(const size_t & entityIndex, const TimePoint & stamp) const
+{
+  assert(entityIndex < entities_.size());
+  const Entity & entity = entities_[entityIndex];
+  return !entity.isExcluded || stamp >= entity.nextProbeStamp;
+}
+
+//-----------------------------------------------------------------------------
+void RTLSProbingBackoff::commitProbe(const size_t & entityIndex, const TimePoint & stamp)
+{
+  assert(entityIndex < entities_.size());
+  Entity & entity = entities_[entityIndex];
+  if (entity.isExcluded) {
+    entity.nextProbeStamp = stamp + entity.probePeriod;
+    ++numberOfProbes_;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void RTLSProbingBackoff::feedback(
+  const size_t & entityIndex,
+  const TimePoint & stamp,
+  const bool & isSuccessful,
+  const bool & isReliable)
+{
+  assert(entityIndex < entities_.size());
+  Entity & entity = entities_[entityIndex];
+  entity.numberOfConsecutiveFailures = isSuccessful ? 0 : entity.numberOfConsecutiveFailures + 1;
+
+  if (!entity.isExcluded) {
+    if (!isReliable &&
+      entity.numberOfConsecutiveFailures >= MINIMAL_NUMBER_OF_CONSECUTIVE_FAILURES)
+    {
+      entity.isExcluded = true;
+      entity.nextProbeStamp = stamp + entity.probePeriod;
+      ++numberOfExcludedEntities_;
+    }
+  } else if (isSuccessful) {
+    // backoff is only halved so that flapping entities are not probed too often
+    entity.isExcluded = false;
+    entity.probePeriod = std::max(entity.probePeriod / 2, minimalProbePeriod_);
+    --numberOfExcludedEntities_;
+  } else {
+    entity.probePeriod = std::min(entity.probePeriod * 2, maximalProbePeriod_);
+    entity.nextProbeStamp = stamp + entity.probePeriod;
+  }
+}
+
+//-----------------------------------------------------------------------------
+bool RTLSProbingBackoff::isExcluded(const size_t & entityIndex) const
+{
+  assert(entityIndex < entities_.size());
+  return entities_[entityIndex].isExcluded;
+}
+
+//-----------------------------------------------------------------------------
+const Duration & RTLSProbingBackoff::getProbePeriod(const size_t & entityIndex) const
+{
+  assert(entityIndex < entities_.size());
+  return entities_[entityIndex].probePeriod;
+}
+
+//-----------------------------------------------------------------------------
+size_t RTLSProbingBackoff::getNumberOfExcludedEntities() const
+{
+  return numberOfExcludedEntities_;
+}
+
+//-----------------------------------------------------------------------------
+size_t RTLSProbingBackoff::getNumberOfProbes() const
+{
+  return numberOfProbes_;
+}
+
+//-----------------------------------------------------------------------------
+void RTLSProbingBackoff::addEntities(const size_t & numberOfEntities)
+{
+  entities_.resize(
+    entities_.size() + numberOfEntities, Entity{false, 0, minimalProbePeriod_, TimePoint()});
+}
+
+}  // namespace core
+}  // namespace romea
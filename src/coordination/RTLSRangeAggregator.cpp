@@ -0,0 +1,163 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+// romea
+#include "romea_core_rtls/coordination/RTLSRangeAggregator.hpp"
+
+namespace romea
+{
+namespace core
+{
+
+//-----------------------------------------------------------------------------
+RTLSRangeAggregator::RTLSRangeAggregator(
+  const size_t & numberOfInitiators,
+  const size_t & numberOfResponders,
+  const Duration & maximalRangeAge,
+  const Duration & window,
+  const size_t & minimalNumberOfNewRangesPerInitiator,
+  RangesCallback rangesCallback)
+: numberOfInitiators_(numberOfInitiators),
+  numberOfResponders_(numberOfResponders),
+  maximalRangeAge_(maximalRangeAge),
+  window_(window),
+  minimalNumberOfNewRangesPerInitiator_(minimalNumberOfNewRangesPerInitiator),
+  rangesCallback_(rangesCallback),
+  lastRanges_(numberOfInitiators * numberOfResponders, 0),
+  lastRangesStamps_(numberOfInitiators * numberOfResponders),
+  newRangesFlags_(numberOfInitiators * numberOfResponders, 0),
+  numbersOfNewRanges_(numberOfInitiators, 0),
+  lastEmissionStamp_(),
+  ranges_(numberOfInitiators, RangeVector(numberOfResponders))
+{
+}
+
+//-----------------------------------------------------------------------------
+void RTLSRangeAggregator::update(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex,
+  const RTLSTransceiverRangingResult & result)
+{
+  update(initiatorIndex, responderIndex, result, now());
+}
+
+//-----------------------------------------------------------------------------
+void RTLSRangeAggregator::update(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex,
+  const RTLSTransceiverRangingResult & result,
+  const TimePoint & stamp)
+{
+  assert(initiatorIndex < numberOfInitiators_);
+  assert(responderIndex < numberOfResponders_);
+
+  const bool isWindowElapsed = isWindowElapsed_(stamp);
+  if (!isEmpty(result)) {
+    const size_t index = initiatorIndex * numberOfResponders_ + responderIndex;
+    lastRanges_[index] = result.range;
+    lastRangesStamps_[index] = stamp;
+
+    if (!newRangesFlags_[index]) {
+      newRangesFlags_[index] = 1;
+      ++numbersOfNewRanges_[initiatorIndex];
+    }
+  }
+
+  if (isCoverageReached_() || isWindowElapsed) {
+    emit_(stamp);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void RTLSRangeAggregator::poll()
+{
+  poll(now());
+}
+
+//-----------------------------------------------------------------------------
+void RTLSRangeAggregator::poll(const TimePoint & stamp)
+{
+  if (isWindowElapsed_(stamp)) {
+    emit_(stamp);
+  }
+}
+
+//-----------------------------------------------------------------------------
+const RTLSRangeAggregator::RangeArray & RTLSRangeAggregator::getRanges(const TimePoint & stamp)
+{
+  for (size_t i = 0, index = 0; i < numberOfInitiators_; ++i) {
+    for (size_t j = 0; j < numberOfResponders_; ++j, ++index) {
+      if (lastRangesStamps_[index] != TimePoint() &&
+        duration(stamp, lastRangesStamps_[index]) <= maximalRangeAge_)
+      {
+        ranges_[i][j] = lastRanges_[index];
+      } else {
+        ranges_[i][j].reset();
+      }
+    }
+  }
+  return ranges_;
+}
+
+//-----------------------------------------------------------------------------
+void RTLSRangeAggregator::reset()
+{
+  std::fill(lastRangesStamps_.begin(), lastRangesStamps_.end(), TimePoint());
+  std::fill(newRangesFlags_.begin(), newRangesFlags_.end(), 0);
+  std::fill(numbersOfNewRanges_.begin(), numbersOfNewRanges_.end(), 0);
+  lastEmissionStamp_.reset();
+}
+
+//-----------------------------------------------------------------------------
+bool RTLSRangeAggregator::isCoverageReached_() const
+{
+  return std::all_of(
+    numbersOfNewRanges_.begin(), numbersOfNewRanges_.end(), [this](const size_t & n) {
+      return n >= minimalNumberOfNewRangesPerInitiator_;
+    });
+}
+
+//-----------------------------------------------------------------------------
+bool RTLSRangeAggregator::isWindowElapsed_(const TimePoint & stamp)
+{
+  if (!lastEmissionStamp_.has_value()) {
+    lastEmissionStamp_ = stamp;
+  }
+  return duration(stamp, *lastEmissionStamp_) >= window_;
+}
+
+//-----------------------------------------------------------------------------
+void RTLSRangeAggregator::emit_(const TimePoint & stamp)
+{
+  bool isAnyNewRange = std::any_of(
+    numbersOfNewRanges_.begin(), numbersOfNewRanges_.end(), [](const size_t & n) {
+      return n != 0;
+    });
+
+  std::fill(newRangesFlags_.begin(), newRangesFlags_.end(), 0);
+  std::fill(numbersOfNewRanges_.begin(), numbersOfNewRanges_.end(), 0);
+  lastEmissionStamp_ = stamp;
+
+  if (isAnyNewRange) {
+    rangesCallback_(getRanges(stamp));
+  }
+}
+
+}  // namespace core
+}  // namespace romea
@@ -0,0 +1,211 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+// romea
+#include "romea_core_rtls/coordination/RTLSRangeStatistics.hpp"
+
+namespace
+{
+// nominal weights are kept until innovation variance has settled
+const size_t MINIMAL_NUMBER_OF_INNOVATIONS = 10;
+const double INNOVATION_SMOOTHING_FACTOR = 0.02;
+// in seconds, tag may have accelerated too much since previous ranges to predict it
+const double MAXIMAL_RANGES_INTERVAL = 1.0;
+}
+
+namespace romea
+{
+namespace core
+{
+
+//-----------------------------------------------------------------------------
+RTLSRangeStatistics::RTLSRangeStatistics(
+  const size_t & numberOfInitiators,
+  const size_t & numberOfResponders,
+  const double & nominalRangeStd,
+  const double & jumpThreshold)
+: numberOfInitiators_(numberOfInitiators),
+  nominalRangeStd_(nominalRangeStd),
+  jumpThreshold_(jumpThreshold),
+  links_(numberOfInitiators * numberOfResponders, makeLink_())
+{
+  assert(nominalRangeStd > 0);
+  assert(jumpThreshold > 0);
+}
+
+//-----------------------------------------------------------------------------
+RTLSRangeStatistics::Link RTLSRangeStatistics::makeLink_() const
+{
+  return {0, 0, 0, 0, 0, TimePoint(), 0, TimePoint(), 0, 0,
+    RTLSStreamingQuantile(0.5), RTLSStreamingQuantile(HIGH_QUANTILE_PROBABILITY)};
+}
+
+//-----------------------------------------------------------------------------
+size_t RTLSRangeStatistics::linkIndex_(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex) const
+{
+  // responder major so that new responders are appended
+  assert(initiatorIndex < numberOfInitiators_);
+  assert(responderIndex * numberOfInitiators_ + initiatorIndex < links_.size());
+  return responderIndex * numberOfInitiators_ + initiatorIndex;
+}
+
+//-----------------------------------------------------------------------------
+void RTLSRangeStatistics::update(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex,
+  const double & range,
+  const TimePoint & stamp)
+{
+  Link & link = links_[linkIndex_(initiatorIndex, responderIndex)];
+  ++link.numberOfRanges;
+
+  double elapsedTime = durationToSecond(stamp - link.lastStamp);
+  if (link.numberOfConsecutiveRanges == 0 || elapsedTime <= 0 ||
+    elapsedTime > MAXIMAL_RANGES_INTERVAL)
+  {
+    link.numberOfConsecutiveRanges = 1;
+    link.lastRange = range;
+    link.lastStamp = stamp;
+    return;
+  }
+
+  if (link.numberOfConsecutiveRanges++ == 1) {
+    link.previousRange = link.lastRange;
+    link.previousStamp = link.lastStamp;
+    link.lastRange = range;
+    link.lastStamp = stamp;
+    return;
+  }
+
+  // range is linearly extrapolated from the two previous ones and innovation is scaled
+  // to the variance of a difference of two ranges whatever the polling intervals
+  double ratio = elapsedTime / durationToSecond(link.lastStamp - link.previousStamp);
+  double predictedRange = link.lastRange + ratio * (link.lastRange - link.previousRange);
+  double innovation = (range - predictedRange) *
+    std::sqrt(2 / (1 + std::pow(1 + ratio, 2) + ratio * ratio));
+  link.previousRange = link.lastRange;
+  link.previousStamp = link.lastStamp;
+  link.lastRange = range;
+  link.lastStamp = stamp;
+
+  // plain averages until enough innovations have been gathered to forget older ones
+  ++link.numberOfInnovations;
+  double smoothingFactor = std::max(
+    1. / link.numberOfInnovations, INNOVATION_SMOOTHING_FACTOR);
+  double deviation = innovation - link.innovationMean;
+  link.innovationMean += smoothingFactor * deviation;
+  link.innovationVariance = (1 - smoothingFactor) *
+    (link.innovationVariance + smoothingFactor * deviation * deviation);
+
+  double absoluteInnovation = std::abs(innovation);
+  link.medianAbsoluteInnovation.update(absoluteInnovation);
+  link.highAbsoluteInnovation.update(absoluteInnovation);
+  if (absoluteInnovation > jumpThreshold_) {
+    ++link.numberOfJumps;
+  }
+}
+
+//-----------------------------------------------------------------------------
+double RTLSRangeStatistics::computeInnovationVariance_(const Link & link) const
+{
+  if (link.numberOfInnovations < 2) {
+    return std::nan("");
+  }
+  return link.innovationVariance;
+}
+
+//-----------------------------------------------------------------------------
+double RTLSRangeStatistics::computeRangeStd_(const Link & link) const
+{
+  if (link.numberOfInnovations < MINIMAL_NUMBER_OF_INNOVATIONS) {
+    return nominalRangeStd_;
+  }
+  return std::max(std::sqrt(computeInnovationVariance_(link) / 2), nominalRangeStd_);
+}
+
+//-----------------------------------------------------------------------------
+RTLSLinkRangeStatistics RTLSRangeStatistics::get(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex) const
+{
+  const Link & link = links_[linkIndex_(initiatorIndex, responderIndex)];
+  double rangeStd = computeRangeStd_(link);
+  return {
+    link.numberOfRanges,
+    link.numberOfJumps,
+    link.numberOfRanges == 0 ? std::nan("") : link.lastRange,
+    link.numberOfInnovations == 0 ? std::nan("") : link.innovationMean,
+    std::sqrt(computeInnovationVariance_(link)),
+    link.medianAbsoluteInnovation.get(),
+    link.highAbsoluteInnovation.get(),
+    rangeStd,
+    std::pow(nominalRangeStd_ / rangeStd, 2)};
+}
+
+//-----------------------------------------------------------------------------
+double RTLSRangeStatistics::getRangeStd(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex) const
+{
+  return computeRangeStd_(links_[linkIndex_(initiatorIndex, responderIndex)]);
+}
+
+//-----------------------------------------------------------------------------
+double RTLSRangeStatistics::getRangeWeight(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex) const
+{
+  return std::pow(nominalRangeStd_ / getRangeStd(initiatorIndex, responderIndex), 2);
+}
+
+//-----------------------------------------------------------------------------
+void RTLSRangeStatistics::getRangesWeights(
+  const size_t & initiatorIndex,
+  std::vector<double> & weights) const
+{
+  weights.resize(links_.size() / numberOfInitiators_);
+  for (size_t r = 0; r < weights.size(); ++r) {
+    weights[r] = getRangeWeight(initiatorIndex, r);
+  }
+}
+
+//-----------------------------------------------------------------------------
+const double & RTLSRangeStatistics::getNominalRangeStd() const
+{
+  return nominalRangeStd_;
+}
+
+//-----------------------------------------------------------------------------
+const double & RTLSRangeStatistics::getJumpThreshold() const
+{
+  return jumpThreshold_;
+}
+
+//-----------------------------------------------------------------------------
+size_t RTLSRangeStatistics::addResponder()
+{
+  links_.resize(links_.size() + numberOfInitiators_, makeLink_());
+  return links_.size() / numberOfInitiators_ - 1;
+}
+
+}  // namespace core
+}  // namespace romea
@@ -14,12 +14,20 @@
 
 // std
 #include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
 #include <vector>
-#include <iostream>
 
 // romea
 #include "romea_core_rtls/coordination/RTLSReachableTransceivers.hpp"
 
+namespace
+{
+const size_t MAXIMAL_NUMBER_OF_CELLS_PER_POINT = 4;
+const size_t MINIMAL_NUMBER_OF_CELLS = 1024;
+}
+
 namespace romea
 {
 namespace core
@@ -28,24 +36,232 @@ namespace core
 //-----------------------------------------------------------------------------
 RTLSReachableTransceivers::RTLSReachableTransceivers(
   const VectorOfEigenVector3d & points,
-  const double & researchRadius)
-: squaredResearchRadius_(researchRadius * researchRadius),
+  const double & researchRadius,
+  const double & hysteresisDistance)
+: researchRadius_(researchRadius),
+  hysteresisDistance_(hysteresisDistance),
   points_(points),
-  kdTree_(points_),
-  neighborIndexes_(points.size()),
-  neighborSquareDistances_(points.size())
+  activePoints_(points.size(), 1),
+  gridOrigin_(Eigen::Vector2d::Zero()),
+  cellSize_(0),
+  numberOfColumns_(0),
+  numberOfRows_(0),
+  cells_(),
+  outsidePointsIndexes_(),
+  isResearchCached_(false),
+  lastResearchPosition_(Eigen::Vector3d::Zero()),
+  numberOfResearches_(0),
+  candidateIndexes_(),
+  neighborIndexes_()
 {
+  assert(researchRadius >= 0 && hysteresisDistance >= 0);
+  candidateIndexes_.reserve(points.size());
+  neighborIndexes_.reserve(points.size());
+  buildGrid_();
 }
 
 //-----------------------------------------------------------------------------
 const std::vector<size_t> & RTLSReachableTransceivers::find(const Eigen::Vector3d & position)
 {
-  kdTree_.radiusResearch(
-    position, squaredResearchRadius_, neighborIndexes_, neighborSquareDistances_);
+  if (hysteresisDistance_ == 0) {
+    research_(position, researchRadius_, neighborIndexes_);
+    return neighborIndexes_;
+  }
+
+  if (!isResearchCached_ || (position - lastResearchPosition_).norm() > hysteresisDistance_) {
+    // research is extended by hysteresis distance, so cached candidates still
+    // include all reachable transceivers as long as position stays in hysteresis region
+    research_(position, researchRadius_ + hysteresisDistance_, candidateIndexes_);
+    lastResearchPosition_ = position;
+    isResearchCached_ = true;
+  }
+
+  const double squaredResearchRadius = researchRadius_ * researchRadius_;
+  neighborIndexes_.clear();
+  for (const size_t & index : candidateIndexes_) {
+    if ((points_[index] - position).squaredNorm() <= squaredResearchRadius) {
+      neighborIndexes_.push_back(index);
+    }
+  }
 
-  std::sort(neighborIndexes_.begin(), neighborIndexes_.end());
   return neighborIndexes_;
 }
 
+//-----------------------------------------------------------------------------
+void RTLSReachableTransceivers::setHysteresisDistance(const double & hysteresisDistance)
+{
+  assert(hysteresisDistance >= 0);
+  if (hysteresisDistance != hysteresisDistance_) {
+    hysteresisDistance_ = hysteresisDistance;
+    isResearchCached_ = false;
+  }
+}
+
+//-----------------------------------------------------------------------------
+size_t RTLSReachableTransceivers::getNumberOfResearches() const
+{
+  return numberOfResearches_;
+}
+
+//-----------------------------------------------------------------------------
+size_t RTLSReachableTransceivers::add(const Eigen::Vector3d & point)
+{
+  points_.push_back(point);
+  activePoints_.push_back(1);
+  insertInCell_(points_.size() - 1);
+  isResearchCached_ = false;
+  return points_.size() - 1;
+}
+
+//-----------------------------------------------------------------------------
+void RTLSReachableTransceivers::remove(const size_t & index)
+{
+  assert(index < points_.size());
+  if (activePoints_[index]) {
+    removeFromCell_(index);
+    activePoints_[index] = 0;
+    isResearchCached_ = false;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void RTLSReachableTransceivers::update(const size_t & index, const Eigen::Vector3d & point)
+{
+  assert(index < points_.size());
+  if (activePoints_[index]) {
+    removeFromCell_(index);
+    points_[index] = point;
+    insertInCell_(index);
+    isResearchCached_ = false;
+  } else {
+    points_[index] = point;
+  }
+}
+
+//-----------------------------------------------------------------------------
+const Eigen::Vector3d & RTLSReachableTransceivers::getPoint(const size_t & index) const
+{
+  return points_[index];
+}
+
+//-----------------------------------------------------------------------------
+void RTLSReachableTransceivers::buildGrid_()
+{
+  if (points_.empty()) {
+    return;
+  }
+
+  Eigen::Vector2d minimal = points_[0].head<2>();
+  Eigen::Vector2d maximal = points_[0].head<2>();
+  for (const auto & point : points_) {
+    minimal = minimal.cwiseMin(point.head<2>());
+    maximal = maximal.cwiseMax(point.head<2>());
+  }
+
+  // cell size is half research radius so a research only visits a few cells,
+  // it is enlarged when it would create too many empty cells
+  const size_t maximalNumberOfCells = std::max(
+    MINIMAL_NUMBER_OF_CELLS, MAXIMAL_NUMBER_OF_CELLS_PER_POINT * points_.size());
+  Eigen::Vector2d extent = maximal - minimal;
+
+  cellSize_ = std::max(researchRadius_ / 2, std::numeric_limits<double>::epsilon());
+  while ((std::floor(extent.x() / cellSize_) + 1) * (std::floor(extent.y() / cellSize_) + 1) >
+    maximalNumberOfCells)
+  {
+    cellSize_ *= 2;
+  }
+
+  gridOrigin_ = minimal;
+  numberOfColumns_ = static_cast<size_t>(std::floor(extent.x() / cellSize_)) + 1;
+  numberOfRows_ = static_cast<size_t>(std::floor(extent.y() / cellSize_)) + 1;
+  cells_.resize(numberOfColumns_ * numberOfRows_);
+
+  for (size_t n = 0; n < points_.size(); ++n) {
+    insertInCell_(n);
+  }
+}
+
+//-----------------------------------------------------------------------------
+size_t RTLSReachableTransceivers::cellIndex_(const Eigen::Vector3d & point) const
+{
+  Eigen::Vector2d cell = (point.head<2>() - gridOrigin_) / cellSize_;
+  if (cells_.empty() || !(cell.x() >= 0 && cell.y() >= 0 &&
+    cell.x() < numberOfColumns_ && cell.y() < numberOfRows_))
+  {
+    return cells_.size();
+  }
+
+  return static_cast<size_t>(cell.y()) * numberOfColumns_ + static_cast<size_t>(cell.x());
+}
+
+//-----------------------------------------------------------------------------
+void RTLSReachableTransceivers::insertInCell_(const size_t & index)
+{
+  size_t cellIndex = cellIndex_(points_[index]);
+  if (cellIndex == cells_.size()) {
+    outsidePointsIndexes_.push_back(index);
+  } else {
+    cells_[cellIndex].push_back(index);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void RTLSReachableTransceivers::removeFromCell_(const size_t & index)
+{
+  size_t cellIndex = cellIndex_(points_[index]);
+  auto & indexes = cellIndex == cells_.size() ? outsidePointsIndexes_ : cells_[cellIndex];
+  auto it = std::find(indexes.begin(), indexes.end(), index);
+  assert(it != indexes.end());
+  *it = indexes.back();
+  indexes.pop_back();
+}
+
+//-----------------------------------------------------------------------------
+void RTLSReachableTransceivers::research_(
+  const Eigen::Vector3d & position,
+  const double & researchRadius,
+  std::vector<size_t> & researchIndexes)
+{
+  ++numberOfResearches_;
+  researchIndexes.clear();
+
+  const double squaredResearchRadius = researchRadius * researchRadius;
+  auto research = [&](const std::vector<size_t> & indexes) {
+      for (const size_t & index : indexes) {
+        if ((points_[index] - position).squaredNorm() <= squaredResearchRadius) {
+          researchIndexes.push_back(index);
+        }
+      }
+    };
+
+  research(outsidePointsIndexes_);
+
+  Eigen::Vector2d minimal = (position.head<2>() - gridOrigin_).array() - researchRadius;
+  Eigen::Vector2d maximal = (position.head<2>() - gridOrigin_).array() + researchRadius;
+  if (!cells_.empty() && maximal.x() >= 0 && maximal.y() >= 0 &&
+    minimal.x() <= numberOfColumns_ * cellSize_ && minimal.y() <= numberOfRows_ * cellSize_)
+  {
+    auto firstCell = [this](const double & coordinate) {
+        return static_cast<size_t>(std::max(coordinate / cellSize_, 0.));
+      };
+    auto lastCell = [this](const double & coordinate, const size_t & numberOfCells) {
+        return std::min(static_cast<size_t>(coordinate / cellSize_), numberOfCells - 1);
+      };
+
+    const size_t firstColumn = firstCell(minimal.x());
+    const size_t lastColumn = lastCell(maximal.x(), numberOfColumns_);
+    const size_t firstRow = firstCell(minimal.y());
+    const size_t lastRow = lastCell(maximal.y(), numberOfRows_);
+
+    for (size_t row = firstRow; row <= lastRow; ++row) {
+      for (size_t column = firstColumn; column <= lastColumn; ++column) {
+        research(cells_[row * numberOfColumns_ + column]);
+      }
+    }
+  }
+
+  std::sort(researchIndexes.begin(), researchIndexes.end());
+}
+
 }   // namespace core
 }   // namespace romea
@@ -0,0 +1,188 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <algorithm>
+#include <cassert>
+
+// romea
+#include "romea_core_rtls/coordination/RTLSReliabilityStore.hpp"
+
+namespace
+{
+const uint64_t SUM_MASK = 0xffffffff;
+const uint64_t NUMBER_OF_SAMPLES_SHIFT = 32;
+}
+
+namespace romea
+{
+namespace core
+{
+
+//-----------------------------------------------------------------------------
+RTLSReliabilityStore::RTLSReliabilityStore(
+  const size_t & numberOfTransceivers,
+  const size_t & windowSize,
+  const double & lowThreshold,
+  const double & highThreshold)
+: capacity_(numberOfTransceivers),
+  windowSize_(std::max<size_t>(windowSize, 1)),
+  lowThreshold_(lowThreshold),
+  highThreshold_(highThreshold),
+  size_(numberOfTransceivers),
+  windows_(capacity_ * windowSize_, 0),
+  windowsPositions_(capacity_, 0),
+  tallies_(capacity_),
+  statuses_(capacity_)
+{
+  for (size_t n = 0; n < capacity_; ++n) {
+    tallies_[n].store(0, std::memory_order_relaxed);
+    statuses_[n].store(static_cast<uint8_t>(DiagnosticStatus::STALE), std::memory_order_relaxed);
+  }
+}
+
+//-----------------------------------------------------------------------------
+RTLSReliabilityStore::RTLSReliabilityStore(
+  const RTLSReliabilityStore & store,
+  const size_t & capacity)
+: capacity_(capacity),
+  windowSize_(store.windowSize_),
+  lowThreshold_(store.lowThreshold_),
+  highThreshold_(store.highThreshold_),
+  size_(store.size()),
+  windows_(capacity_ * windowSize_, 0),
+  windowsPositions_(capacity_, 0),
+  tallies_(capacity_),
+  statuses_(capacity_)
+{
+  assert(capacity_ >= size_);
+  std::copy(store.windows_.begin(), store.windows_.end(), windows_.begin());
+  std::copy(store.windowsPositions_.begin(), store.windowsPositions_.end(),
+    windowsPositions_.begin());
+
+  for (size_t n = 0; n < capacity_; ++n) {
+    bool isCopied = n < store.capacity_;
+    tallies_[n].store(
+      isCopied ? store.tallies_[n].load(std::memory_order_relaxed) : 0,
+      std::memory_order_relaxed);
+    statuses_[n].store(
+      isCopied ? store.statuses_[n].load(std::memory_order_relaxed) :
+      static_cast<uint8_t>(DiagnosticStatus::STALE),
+      std::memory_order_relaxed);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void RTLSReliabilityStore::update(const size_t & transceiverIndex, const uint8_t & score)
+{
+  assert(transceiverIndex < size());
+  assert(score <= MAXIMAL_SCORE);
+
+  uint8_t * window = windows_.data() + transceiverIndex * windowSize_;
+  uint32_t & position = windowsPositions_[transceiverIndex];
+  uint64_t tally = tallies_[transceiverIndex].load(std::memory_order_relaxed);
+
+  // window is zero initialized so the oldest score can be removed unconditionally
+  uint32_t sum = static_cast<uint32_t>(tally & SUM_MASK) + score - window[position];
+  uint32_t numberOfSamples = static_cast<uint32_t>(tally >> NUMBER_OF_SAMPLES_SHIFT);
+  numberOfSamples += numberOfSamples < windowSize_;
+
+  window[position] = score;
+  position = (position + 1) * (position + 1 != windowSize_);
+
+  tallies_[transceiverIndex].store(
+    static_cast<uint64_t>(numberOfSamples) << NUMBER_OF_SAMPLES_SHIFT | sum,
+    std::memory_order_release);
+  statuses_[transceiverIndex].store(
+    evaluate_(sum, numberOfSamples), std::memory_order_release);
+}
+
+//-----------------------------------------------------------------------------
+uint8_t RTLSReliabilityStore::evaluate_(
+  const uint32_t & sum,
+  const uint32_t & numberOfSamples) const
+{
+  double reliability = static_cast<double>(sum) / (MAXIMAL_SCORE * numberOfSamples);
+  return static_cast<uint8_t>(
+    reliability < lowThreshold_ ? DiagnosticStatus::ERROR :
+    reliability < highThreshold_ ? DiagnosticStatus::WARN :
+    DiagnosticStatus::OK);
+}
+
+//-----------------------------------------------------------------------------
+double RTLSReliabilityStore::getReliability(const size_t & transceiverIndex) const
+{
+  assert(transceiverIndex < size());
+  uint64_t tally = tallies_[transceiverIndex].load(std::memory_order_acquire);
+  uint64_t numberOfSamples = tally >> NUMBER_OF_SAMPLES_SHIFT;
+  if (numberOfSamples == 0) {
+    return 0;
+  }
+  return static_cast<double>(tally & SUM_MASK) / (MAXIMAL_SCORE * numberOfSamples);
+}
+
+//-----------------------------------------------------------------------------
+size_t RTLSReliabilityStore::getNumberOfSamples(const size_t & transceiverIndex) const
+{
+  assert(transceiverIndex < size());
+  return tallies_[transceiverIndex].load(std::memory_order_acquire) >> NUMBER_OF_SAMPLES_SHIFT;
+}
+
+//-----------------------------------------------------------------------------
+DiagnosticStatus RTLSReliabilityStore::getStatus(const size_t & transceiverIndex) const
+{
+  assert(transceiverIndex < size());
+  return static_cast<DiagnosticStatus>(
+    statuses_[transceiverIndex].load(std::memory_order_acquire));
+}
+
+//-----------------------------------------------------------------------------
+RTLSTransceiverReliability RTLSReliabilityStore::load(const size_t & transceiverIndex) const
+{
+  assert(transceiverIndex < size());
+  uint64_t tally = tallies_[transceiverIndex].load(std::memory_order_acquire);
+  uint32_t sum = static_cast<uint32_t>(tally & SUM_MASK);
+  uint32_t numberOfSamples = static_cast<uint32_t>(tally >> NUMBER_OF_SAMPLES_SHIFT);
+  if (numberOfSamples == 0) {
+    return {0, 0, DiagnosticStatus::STALE};
+  }
+  return {
+    static_cast<double>(sum) / (MAXIMAL_SCORE * numberOfSamples),
+    numberOfSamples,
+    static_cast<DiagnosticStatus>(evaluate_(sum, numberOfSamples))};
+}
+
+//-----------------------------------------------------------------------------
+size_t RTLSReliabilityStore::size() const
+{
+  return size_.load(std::memory_order_acquire);
+}
+
+//-----------------------------------------------------------------------------
+size_t RTLSReliabilityStore::capacity() const
+{
+  return capacity_;
+}
+
+//-----------------------------------------------------------------------------
+size_t RTLSReliabilityStore::add()
+{
+  size_t transceiverIndex = size_.load(std::memory_order_relaxed);
+  assert(transceiverIndex < capacity_);
+  size_.store(transceiverIndex + 1, std::memory_order_release);
+  return transceiverIndex;
+}
+
+}  // namespace core
+}  // namespace romea
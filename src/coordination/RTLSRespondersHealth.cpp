@@ -0,0 +1,90 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <mutex>
+
+// romea
+#include "romea_core_rtls/coordination/RTLSRespondersHealth.hpp"
+
+namespace romea
+{
+namespace core
+{
+
+//-----------------------------------------------------------------------------
+RTLSRespondersHealth::RTLSRespondersHealth(
+  const size_t & numberOfResponders,
+  const Duration & minimalProbePeriod,
+  const Duration & maximalProbePeriod)
+: mutex_(),
+  backoff_(numberOfResponders, minimalProbePeriod, maximalProbePeriod)
+{
+}
+
+//-----------------------------------------------------------------------------
+bool RTLSRespondersHealth::canPoll(const size_t & responderIndex, const TimePoint & stamp)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return backoff_.canPoll(responderIndex, stamp);
+}
+
+//-----------------------------------------------------------------------------
+void RTLSRespondersHealth::commitProbe(const size_t & responderIndex, const TimePoint & stamp)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  backoff_.commitProbe(responderIndex, stamp);
+}
+
+//-----------------------------------------------------------------------------
+void RTLSRespondersHealth::feedback(
+  const size_t & responderIndex,
+  const TimePoint & stamp,
+  const bool & isSuccessful,
+  const bool & isReliable)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  backoff_.feedback(responderIndex, stamp, isSuccessful, isReliable);
+}
+
+//-----------------------------------------------------------------------------
+bool RTLSRespondersHealth::isHealthy(const size_t & responderIndex)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return !backoff_.isExcluded(responderIndex);
+}
+
+//-----------------------------------------------------------------------------
+Duration RTLSRespondersHealth::getProbePeriod(const size_t & responderIndex)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return backoff_.getProbePeriod(responderIndex);
+}
+
+//-----------------------------------------------------------------------------
+size_t RTLSRespondersHealth::getNumberOfProbes()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return backoff_.getNumberOfProbes();
+}
+
+//-----------------------------------------------------------------------------
+void RTLSRespondersHealth::addResponder()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  backoff_.addEntities(1);
+}
+
+}  // namespace core
+}  // namespace romea
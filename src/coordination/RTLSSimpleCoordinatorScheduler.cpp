@@ -17,6 +17,7 @@
 #include <string>
 #include <vector>
 #include <iostream>
+#include <numeric>
 
 // romea
 #include "romea_core_rtls/coordination/RTLSSimpleCoordinatorScheduler.hpp"
@@ -31,36 +32,384 @@ RTLSSimpleCoordinatorScheduler::RTLSSimpleCoordinatorScheduler(
   const double & pollRate,
   const std::vector<std::string> & initiatorsNames,
   const std::vector<std::string> & respondersNames,
-  RangingRequestCallback rangingRequestCallback)
+  RangingRequestCallback rangingRequestCallback,
+  const PollingMode & pollingMode,
+  std::shared_ptr<RTLSClock> clock)
 : numberOfInitiators_(initiatorsNames.size()),
   initiatorsPollIndex_(initiatorsNames.size() - 1),
   numberOfResponders_(respondersNames.size()),
   respondersPollIndex_(respondersNames.size() - 1),
-  timer_(std::bind(&RTLSSimpleCoordinatorScheduler::timerCallback_, this),
-    durationFromSecond(1 / pollRate)),
-  timeout_(durationFromSecond(pollRate) - durationFromMilliSecond(1)),
+  pollPeriod_(durationFromSecond(1 / pollRate)),
+  clock_(clock),
+  ticker_(clock_->createTicker(
+      std::bind(&RTLSSimpleCoordinatorScheduler::timerCallback_, this), pollPeriod_)),
+  timeout_(pollPeriod_ - durationFromMilliSecond(1)),
+  linksLatencies_(nullptr),
+  respondersHealth_(nullptr),
+  linksHealth_(nullptr),
   rangingRequestCallback_(rangingRequestCallback),
-  diagnostics_(pollRate, initiatorsNames, respondersNames)
+  diagnostics_(pollRate, initiatorsNames, respondersNames),
+  isSuperframeEnabled_(false),
+  superframe_(),
+  pollingMode_(pollingMode),
+  pollMutex_(),
+  isRunning_(false),
+  isPolling_(false),
+  isPollRequested_(false),
+  isRequestPending_(false),
+  pendingInitiatorIndex_(0),
+  pendingResponderIndex_(0),
+  pendingTimeout_(timeout_),
+  lastRequestStamp_()
 {
 }
 
 //-----------------------------------------------------------------------------
 void RTLSSimpleCoordinatorScheduler::start()
 {
-  timer_.start();
+  {
+    std::lock_guard<std::mutex> lock(pollMutex_);
+    isRunning_ = true;
+  }
+
+  if (pollingMode_ == PollingMode::COMPLETION) {
+    pollNext_();
+  }
+
+  ticker_->start();
 }
 
 //-----------------------------------------------------------------------------
 void RTLSSimpleCoordinatorScheduler::stop()
 {
-  timer_.stop();
+  {
+    std::lock_guard<std::mutex> lock(pollMutex_);
+    isRunning_ = false;
+  }
+
+  ticker_->stop();
 }
 
 //-----------------------------------------------------------------------------
 void RTLSSimpleCoordinatorScheduler::timerCallback_()
 {
-  incrementPollIndexes_();
-  rangingRequestCallback_(initiatorsPollIndex_, respondersPollIndex_, timeout_);
+  if (pollingMode_ == PollingMode::TIMER) {
+    poll_();
+    return;
+  }
+
+  // in completion mode the timer is only a watchdog restarting polling
+  // when a request has been lost or when nothing could be requested
+  bool isPollingStalled = false;
+  {
+    std::lock_guard<std::mutex> lock(pollMutex_);
+    isPollingStalled = !isPolling_ &&
+      (!isRequestPending_ || duration(clock_->now(), lastRequestStamp_) > pendingTimeout_);
+    if (isPollingStalled) {
+      isRequestPending_ = false;
+    }
+  }
+
+  if (isPollingStalled) {
+    pollNext_();
+  }
+}
+
+//-----------------------------------------------------------------------------
+void RTLSSimpleCoordinatorScheduler::poll_()
+{
+  if (isSuperframeEnabled_) {
+    pollSuperframe_();
+    return;
+  }
+
+  size_t numberOfPolls = numberOfInitiators_ * numberOfResponders_;
+  do {
+    incrementPollIndexes_();
+  } while (!canPoll_(initiatorsPollIndex_, respondersPollIndex_) && --numberOfPolls > 0);
+
+  if (numberOfPolls > 0) {
+    request_(initiatorsPollIndex_, respondersPollIndex_);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void RTLSSimpleCoordinatorScheduler::enableSuperframe()
+{
+  isSuperframeEnabled_ = true;
+  buildSuperframe_();
+}
+
+//-----------------------------------------------------------------------------
+void RTLSSimpleCoordinatorScheduler::disableSuperframe()
+{
+  isSuperframeEnabled_ = false;
+  superframe_.clear();
+}
+
+//-----------------------------------------------------------------------------
+const RTLSSuperframe & RTLSSimpleCoordinatorScheduler::getSuperframe() const
+{
+  return superframe_;
+}
+
+//-----------------------------------------------------------------------------
+void RTLSSimpleCoordinatorScheduler::pollSuperframe_()
+{
+  if (superframe_.isAtFrameStart()) {
+    startSuperframe_();
+  }
+
+  // slots of unhealthy responders or pruned links are skipped until the end of the frame
+  while (!superframe_.empty()) {
+    const auto & slot = superframe_.next();
+    if (canPoll_(slot.initiatorIndex, slot.responderIndex)) {
+      initiatorsPollIndex_ = slot.initiatorIndex;
+      respondersPollIndex_ = slot.responderIndex;
+      request_(slot.initiatorIndex, slot.responderIndex);
+      return;
+    }
+
+    if (superframe_.isAtFrameStart()) {
+      return;
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void RTLSSimpleCoordinatorScheduler::buildSuperframe_()
+{
+  std::vector<size_t> respondersIndexes(numberOfResponders_);
+  std::iota(respondersIndexes.begin(), respondersIndexes.end(), 0);
+  superframe_.build(
+    numberOfInitiators_,
+    respondersIndexes,
+    std::vector<size_t>(numberOfResponders_, 1));
+}
+
+//-----------------------------------------------------------------------------
+void RTLSSimpleCoordinatorScheduler::startSuperframe_()
+{
+}
+
+//-----------------------------------------------------------------------------
+void RTLSSimpleCoordinatorScheduler::request_(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex)
+{
+  Duration timeout = getTimeout(initiatorIndex, responderIndex);
+  TimePoint stamp = clock_->now();
+
+  {
+    std::lock_guard<std::mutex> lock(pollMutex_);
+    isRequestPending_ = true;
+    pendingInitiatorIndex_ = initiatorIndex;
+    pendingResponderIndex_ = responderIndex;
+    pendingTimeout_ = timeout;
+    lastRequestStamp_ = stamp;
+  }
+
+  commitProbes_(initiatorIndex, responderIndex, stamp);
+
+  if (linksLatencies_) {
+    linksLatencies_->request(initiatorIndex, responderIndex, stamp);
+  }
+
+  rangingRequestCallback_(initiatorIndex, responderIndex, timeout);
+}
+
+//-----------------------------------------------------------------------------
+void RTLSSimpleCoordinatorScheduler::dispatch(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex,
+  const Duration & timeout)
+{
+  TimePoint stamp = clock_->now();
+
+  {
+    std::lock_guard<std::mutex> lock(pollMutex_);
+    if (isRequestPending_ &&
+      pendingInitiatorIndex_ == initiatorIndex &&
+      pendingResponderIndex_ == responderIndex)
+    {
+      pendingTimeout_ = timeout;
+      lastRequestStamp_ = stamp;
+    }
+  }
+
+  if (linksLatencies_) {
+    linksLatencies_->request(initiatorIndex, responderIndex, stamp);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void RTLSSimpleCoordinatorScheduler::enableAdaptiveTimeouts(
+  const double & latencyQuantile,
+  const double & timeoutMargin,
+  const Duration & minimalTimeout)
+{
+  linksLatencies_ = std::make_unique<RTLSLinksLatencies>(
+    numberOfInitiators_,
+    numberOfResponders_,
+    latencyQuantile,
+    timeoutMargin,
+    minimalTimeout);
+}
+
+//-----------------------------------------------------------------------------
+void RTLSSimpleCoordinatorScheduler::disableAdaptiveTimeouts()
+{
+  linksLatencies_.reset();
+}
+
+//-----------------------------------------------------------------------------
+Duration RTLSSimpleCoordinatorScheduler::getTimeout(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex)
+{
+  if (linksLatencies_) {
+    return linksLatencies_->computeTimeout(initiatorIndex, responderIndex, timeout_);
+  }
+  return timeout_;
+}
+
+//-----------------------------------------------------------------------------
+void RTLSSimpleCoordinatorScheduler::enableHealthAwareRotation(
+  const Duration & minimalProbePeriod,
+  const Duration & maximalProbePeriod)
+{
+  respondersHealth_ = std::make_unique<RTLSRespondersHealth>(
+    numberOfResponders_,
+    minimalProbePeriod,
+    maximalProbePeriod);
+}
+
+//-----------------------------------------------------------------------------
+void RTLSSimpleCoordinatorScheduler::disableHealthAwareRotation()
+{
+  respondersHealth_.reset();
+}
+
+//-----------------------------------------------------------------------------
+bool RTLSSimpleCoordinatorScheduler::isResponderHealthy(const size_t & responderIndex)
+{
+  return !respondersHealth_ || respondersHealth_->isHealthy(responderIndex);
+}
+
+//-----------------------------------------------------------------------------
+void RTLSSimpleCoordinatorScheduler::enableLinksPruning(
+  const double & minimalLinkQuality,
+  const Duration & minimalProbePeriod,
+  const Duration & maximalProbePeriod)
+{
+  linksHealth_ = std::make_unique<RTLSLinksHealth>(
+    numberOfInitiators_,
+    numberOfResponders_,
+    minimalLinkQuality,
+    minimalProbePeriod,
+    maximalProbePeriod);
+}
+
+//-----------------------------------------------------------------------------
+void RTLSSimpleCoordinatorScheduler::disableLinksPruning()
+{
+  linksHealth_.reset();
+}
+
+//-----------------------------------------------------------------------------
+bool RTLSSimpleCoordinatorScheduler::isLinkPruned(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex)
+{
+  return linksHealth_ && linksHealth_->isPruned(initiatorIndex, responderIndex);
+}
+
+//-----------------------------------------------------------------------------
+double RTLSSimpleCoordinatorScheduler::getLinkQuality(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex) const
+{
+  return diagnostics_.getLinkQuality(initiatorIndex, responderIndex);
+}
+
+//-----------------------------------------------------------------------------
+RTLSLinkRangeStatistics RTLSSimpleCoordinatorScheduler::getLinkRangeStatistics(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex) const
+{
+  return diagnostics_.getLinkRangeStatistics(initiatorIndex, responderIndex);
+}
+
+//-----------------------------------------------------------------------------
+void RTLSSimpleCoordinatorScheduler::getRangesWeights(
+  const size_t & initiatorIndex,
+  std::vector<double> & weights) const
+{
+  diagnostics_.getRangesWeights(initiatorIndex, weights);
+}
+
+//-----------------------------------------------------------------------------
+bool RTLSSimpleCoordinatorScheduler::canPoll_(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex)
+{
+  TimePoint stamp = clock_->now();
+  return (!respondersHealth_ || respondersHealth_->canPoll(responderIndex, stamp)) &&
+         (!linksHealth_ || linksHealth_->canPoll(initiatorIndex, responderIndex, stamp));
+}
+
+//-----------------------------------------------------------------------------
+void RTLSSimpleCoordinatorScheduler::commitProbes_(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex,
+  const TimePoint & stamp)
+{
+  if (respondersHealth_) {
+    respondersHealth_->commitProbe(responderIndex, stamp);
+  }
+
+  if (linksHealth_) {
+    linksHealth_->commitProbe(initiatorIndex, responderIndex, stamp);
+  }
+}
+
+//-----------------------------------------------------------------------------
+bool RTLSSimpleCoordinatorScheduler::completeRequest_(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex,
+  const TimePoint & requestStamp)
+{
+  std::lock_guard<std::mutex> lock(pollMutex_);
+  if (isRequestPending_ &&
+    pendingInitiatorIndex_ == initiatorIndex &&
+    pendingResponderIndex_ == responderIndex &&
+    requestStamp >= lastRequestStamp_)
+  {
+    isRequestPending_ = false;
+    return true;
+  }
+  return false;
+}
+
+//-----------------------------------------------------------------------------
+void RTLSSimpleCoordinatorScheduler::pollNext_()
+{
+  // feedback can be called from inside ranging request callback, in this case
+  // next poll is deferred to the loop below instead of recursing
+  std::unique_lock<std::mutex> lock(pollMutex_);
+  isPollRequested_ = true;
+  if (isPolling_) {
+    return;
+  }
+
+  isPolling_ = true;
+  while (isPollRequested_ && isRunning_) {
+    isPollRequested_ = false;
+    lock.unlock();
+    poll_();
+    lock.lock();
+  }
+  isPolling_ = false;
 }
 
 //-----------------------------------------------------------------------------
@@ -69,7 +418,45 @@ void RTLSSimpleCoordinatorScheduler::feedback(
   const size_t & responderIndex,
   const RangingResult & result)
 {
-  diagnostics_.update(initiatorIndex, responderIndex, result);
+  // without request stamp, feedback completes the request in progress for its pair
+  feedback(initiatorIndex, responderIndex, result, TimePoint::max());
+}
+
+//-----------------------------------------------------------------------------
+void RTLSSimpleCoordinatorScheduler::feedback(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex,
+  const RangingResult & result,
+  const TimePoint & requestStamp)
+{
+  diagnostics_.update(initiatorIndex, responderIndex, result, clock_->now());
+
+  if (linksLatencies_) {
+    linksLatencies_->feedback(
+      initiatorIndex, responderIndex, clock_->now(), !isEmpty(result), requestStamp);
+  }
+
+  if (respondersHealth_) {
+    // when links are pruned separately, a responder blocked for some initiators
+    // but fine for others must not be left out of rotation
+    bool isResponderReliable = diagnostics_.isResponderReliable(responderIndex) ||
+      (linksHealth_ && diagnostics_.getResponderBestLinkQuality(responderIndex) >=
+      linksHealth_->getMinimalQuality());
+    respondersHealth_->feedback(
+      responderIndex, clock_->now(), !isEmpty(result), isResponderReliable);
+  }
+
+  if (linksHealth_) {
+    linksHealth_->feedback(
+      initiatorIndex, responderIndex, clock_->now(), !isEmpty(result),
+      diagnostics_.getLinkQuality(initiatorIndex, responderIndex));
+  }
+
+  if (pollingMode_ == PollingMode::COMPLETION &&
+    completeRequest_(initiatorIndex, responderIndex, requestStamp))
+  {
+    pollNext_();
+  }
 }
 
 
@@ -89,16 +476,21 @@ void RTLSSimpleCoordinatorScheduler::incrementPollIndexes_()
 //-----------------------------------------------------------------------------
 DiagnosticReport RTLSSimpleCoordinatorScheduler::getReport()
 {
-  DiagnosticReport report;
-  for (size_t i = 0; i < numberOfInitiators_; ++i) {
-    report += diagnostics_.getInitiatorReport(i);
-  }
+  return diagnostics_.getReport();
+}
 
-  for (size_t i = 0; i < numberOfResponders_; ++i) {
-    report += diagnostics_.getResponderReport(i);
-  }
+//-----------------------------------------------------------------------------
+void RTLSSimpleCoordinatorScheduler::getInitiatorsReliabilities(
+  std::vector<RTLSTransceiverReliability> & reliabilities) const
+{
+  diagnostics_.getInitiatorsReliabilities(reliabilities);
+}
 
-  return report;
+//-----------------------------------------------------------------------------
+void RTLSSimpleCoordinatorScheduler::getRespondersReliabilities(
+  std::vector<RTLSTransceiverReliability> & reliabilities) const
+{
+  diagnostics_.getRespondersReliabilities(reliabilities);
 }
 
 }  // namespace core
@@ -0,0 +1,138 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+// romea
+#include "romea_core_rtls/coordination/RTLSStreamingQuantile.hpp"
+
+namespace romea
+{
+namespace core
+{
+
+//-----------------------------------------------------------------------------
+RTLSStreamingQuantile::RTLSStreamingQuantile(const double & probability)
+: probability_(probability),
+  numberOfSamples_(0),
+  heights_(),
+  positions_({0, 1, 2, 3, 4}),
+  desiredPositions_({0, 2 * probability, 4 * probability, 2 + 2 * probability, 4})
+{
+  assert(probability > 0 && probability < 1);
+}
+
+//-----------------------------------------------------------------------------
+void RTLSStreamingQuantile::update(const double & sample)
+{
+  // first samples are only sorted into markers heights
+  if (numberOfSamples_ < NUMBER_OF_MARKERS) {
+    auto last = heights_.begin() + numberOfSamples_;
+    auto it = std::upper_bound(heights_.begin(), last, sample);
+    std::copy_backward(it, last, last + 1);
+    *it = sample;
+    ++numberOfSamples_;
+    return;
+  }
+
+  size_t k;
+  if (sample < heights_[0]) {
+    heights_[0] = sample;
+    k = 0;
+  } else if (sample >= heights_[4]) {
+    heights_[4] = sample;
+    k = 3;
+  } else {
+    k = std::upper_bound(heights_.begin() + 1, heights_.end(), sample) - heights_.begin() - 1;
+  }
+
+  for (size_t i = k + 1; i < NUMBER_OF_MARKERS; ++i) {
+    positions_[i] += 1;
+  }
+  desiredPositions_[1] += probability_ / 2;
+  desiredPositions_[2] += probability_;
+  desiredPositions_[3] += (1 + probability_) / 2;
+  desiredPositions_[4] += 1;
+  ++numberOfSamples_;
+
+  // middle markers are moved by one position when they are late or in advance
+  for (size_t i = 1; i < NUMBER_OF_MARKERS - 1; ++i) {
+    double delta = desiredPositions_[i] - positions_[i];
+    if ((delta >= 1 && positions_[i + 1] - positions_[i] > 1) ||
+      (delta <= -1 && positions_[i - 1] - positions_[i] < -1))
+    {
+      double direction = delta > 0 ? 1 : -1;
+      double height = computeParabolicHeight_(i, direction);
+      if (heights_[i - 1] < height && height < heights_[i + 1]) {
+        heights_[i] = height;
+      } else {
+        heights_[i] = computeLinearHeight_(i, direction);
+      }
+      positions_[i] += direction;
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+double RTLSStreamingQuantile::computeParabolicHeight_(
+  const size_t & i,
+  const double & direction) const
+{
+  return heights_[i] + direction / (positions_[i + 1] - positions_[i - 1]) *
+         ((positions_[i] - positions_[i - 1] + direction) * (heights_[i + 1] - heights_[i]) /
+         (positions_[i + 1] - positions_[i]) +
+         (positions_[i + 1] - positions_[i] - direction) * (heights_[i] - heights_[i - 1]) /
+         (positions_[i] - positions_[i - 1]));
+}
+
+//-----------------------------------------------------------------------------
+double RTLSStreamingQuantile::computeLinearHeight_(
+  const size_t & i,
+  const double & direction) const
+{
+  size_t j = direction > 0 ? i + 1 : i - 1;
+  return heights_[i] + direction * (heights_[j] - heights_[i]) / (positions_[j] - positions_[i]);
+}
+
+//-----------------------------------------------------------------------------
+double RTLSStreamingQuantile::get() const
+{
+  if (numberOfSamples_ == 0) {
+    return std::nan("");
+  }
+
+  if (numberOfSamples_ < NUMBER_OF_MARKERS) {
+    size_t index = std::lround(probability_ * (numberOfSamples_ - 1));
+    return heights_[index];
+  }
+  return heights_[2];
+}
+
+//-----------------------------------------------------------------------------
+const double & RTLSStreamingQuantile::getProbability() const
+{
+  return probability_;
+}
+
+//-----------------------------------------------------------------------------
+size_t RTLSStreamingQuantile::getNumberOfSamples() const
+{
+  return numberOfSamples_;
+}
+
+}  // namespace core
+}  // namespace romea
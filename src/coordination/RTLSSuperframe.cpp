@@ -0,0 +1,114 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <cassert>
+#include <numeric>
+#include <vector>
+
+// romea
+#include "romea_core_rtls/coordination/RTLSSuperframe.hpp"
+
+namespace romea
+{
+namespace core
+{
+
+//-----------------------------------------------------------------------------
+RTLSSuperframe::RTLSSuperframe()
+: slots_(),
+  respondersSequence_(),
+  respondersCredits_(),
+  slotIndex_(0)
+{
+}
+
+//-----------------------------------------------------------------------------
+void RTLSSuperframe::build(
+  const size_t & numberOfInitiators,
+  const std::vector<size_t> & respondersIndexes,
+  const std::vector<size_t> & respondersWeights)
+{
+  assert(respondersIndexes.size() == respondersWeights.size());
+
+  // smooth weighted round robin: a responder of weight w appears w times
+  // in the sequence and its occurrences are spread over the whole sequence
+  const long totalWeight = std::accumulate(respondersWeights.begin(), respondersWeights.end(), 0l);
+  respondersCredits_.assign(respondersIndexes.size(), 0);
+  respondersSequence_.clear();
+  for (long n = 0; n < totalWeight; ++n) {
+    size_t best = 0;
+    for (size_t m = 0; m < respondersIndexes.size(); ++m) {
+      respondersCredits_[m] += static_cast<long>(respondersWeights[m]);
+      if (respondersCredits_[m] > respondersCredits_[best]) {
+        best = m;
+      }
+    }
+    respondersCredits_[best] -= totalWeight;
+    respondersSequence_.push_back(respondersIndexes[best]);
+  }
+
+  slots_.clear();
+  slots_.reserve(numberOfInitiators * respondersSequence_.size());
+  for (size_t initiatorIndex = 0; initiatorIndex < numberOfInitiators; ++initiatorIndex) {
+    for (const size_t & responderIndex : respondersSequence_) {
+      slots_.push_back({initiatorIndex, responderIndex});
+    }
+  }
+
+  slotIndex_ = 0;
+}
+
+//-----------------------------------------------------------------------------
+void RTLSSuperframe::clear()
+{
+  slots_.clear();
+  slotIndex_ = 0;
+}
+
+//-----------------------------------------------------------------------------
+bool RTLSSuperframe::empty() const
+{
+  return slots_.empty();
+}
+
+//-----------------------------------------------------------------------------
+size_t RTLSSuperframe::size() const
+{
+  return slots_.size();
+}
+
+//-----------------------------------------------------------------------------
+const RTLSSuperframe::Slot & RTLSSuperframe::operator[](const size_t & slotIndex) const
+{
+  return slots_[slotIndex];
+}
+
+//-----------------------------------------------------------------------------
+bool RTLSSuperframe::isAtFrameStart() const
+{
+  return slotIndex_ == 0;
+}
+
+//-----------------------------------------------------------------------------
+const RTLSSuperframe::Slot & RTLSSuperframe::next()
+{
+  assert(!slots_.empty());
+  const Slot & slot = slots_[slotIndex_];
+  slotIndex_ = slotIndex_ + 1 == slots_.size() ? 0 : slotIndex_ + 1;
+  return slot;
+}
+
+}  // namespace core
+}  // namespace romea
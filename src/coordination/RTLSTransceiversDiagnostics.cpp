@@ -13,9 +13,13 @@
 // limitations under the License.
 
 // std
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
 #include <memory>
+#include <numeric>
 #include <string>
-#include <utility>
 #include <vector>
 
 // romea
@@ -25,9 +29,31 @@ namespace
 {
 const double DEFAULT_LOW_RELIABILITY_THRESHOLD = 0.3;
 const double DEFAULT_HIGH_RELIABILITY_THRESHOLD = 0.8;
-const double AVERAGE_MONITORING_PRECISION = 0.0001;
+
+// reliabilities are counted in thirds of success
+const uint8_t SUCCESS_SCORE = romea::core::RTLSReliabilityStore::MAXIMAL_SCORE;
+const uint8_t INITIATOR_FAILURE_SCORE = 1;
+const uint8_t RESPONDER_FAILURE_SCORE = 0;
+
+// links qualities roughly average their last ten exchanges
+const double LINK_QUALITY_SMOOTHING_FACTOR = 0.2;
+
+// ranges weights are relative to usual UWB ranging accuracy
+const double DEFAULT_NOMINAL_RANGE_STD = 0.1;
+const double DEFAULT_RANGE_JUMP_THRESHOLD = 1.0;
+
+// a report is rendered again when reliability moves to another percent
+const double NUMBER_OF_RELIABILITY_BUCKETS = 100;
+const uint32_t UNRENDERED_REPORT_KEY = std::numeric_limits<uint32_t>::max();
+
+uint32_t reportKey(const romea::core::RTLSTransceiverReliability & reliability)
+{
+  long bucket = std::lround(reliability.reliability * NUMBER_OF_RELIABILITY_BUCKETS);
+  return static_cast<uint32_t>(reliability.status) << 8 | static_cast<uint32_t>(bucket);
 }
 
+}  // namespace
+
 namespace romea
 {
 namespace core
@@ -38,116 +64,284 @@ RTLSTransceiversDiagnostics::RTLSTransceiversDiagnostics(
   const double & pollRate,
   const std::vector<std::string> & initiatorsNames,
   const std::vector<std::string> & respondersNames)
-: responderReliabilityMonitorings_(),
-  responderReliabilityDiagnostics_(),
-  initiatorReliabilityMonitorings_(),
-  initiatorReliabilityDiagnostics_()
+: updateMutex_(),
+  numberOfInitiators_(initiatorsNames.size()),
+  linksQualities_(initiatorsNames.size() * respondersNames.size(), 1.0),
+  rangesStatistics_(
+    initiatorsNames.size(),
+    respondersNames.size(),
+    DEFAULT_NOMINAL_RANGE_STD,
+    DEFAULT_RANGE_JUMP_THRESHOLD),
+  initiatorsReliabilities_(
+    initiatorsNames.size(),
+    2 * pollRate / initiatorsNames.size(),
+    DEFAULT_LOW_RELIABILITY_THRESHOLD,
+    DEFAULT_HIGH_RELIABILITY_THRESHOLD),
+  respondersReliabilities_(nullptr),
+  respondersReliabilitiesStores_(),
+  reportsMutex_(),
+  initiatorsReports_(makeCachedReports_(initiatorsNames)),
+  respondersReports_(makeCachedReports_(respondersNames)),
+  allRespondersIndexes_(),
+  reportRespondersIndexes_(),
+  report_(),
+  numberOfRenderedReports_(0)
 {
-  initInitiatorsDiagnostics_(pollRate, initiatorsNames);
-  initRespondersDiagnostics_(pollRate, respondersNames);
+  respondersReliabilitiesStores_.push_back(
+    std::make_unique<RTLSReliabilityStore>(
+      respondersNames.size(),
+      2 * pollRate / respondersNames.size(),
+      DEFAULT_LOW_RELIABILITY_THRESHOLD,
+      DEFAULT_HIGH_RELIABILITY_THRESHOLD));
+  respondersReliabilities_.store(respondersReliabilitiesStores_.back().get());
 }
 
 //-----------------------------------------------------------------------------
-void RTLSTransceiversDiagnostics::initRespondersDiagnostics_(
-  const double & pollRate,
-  const std::vector<std::string> & respondersNames)
+RTLSTransceiversDiagnostics::CachedReport
+RTLSTransceiversDiagnostics::makeCachedReport_(const std::string & transceiverName)
 {
-  responderReliabilityMonitorings_.clear();
-  responderReliabilityDiagnostics_.clear();
+  return {
+    std::make_unique<CheckupReliability>(
+      transceiverName,
+      DEFAULT_LOW_RELIABILITY_THRESHOLD,
+      DEFAULT_HIGH_RELIABILITY_THRESHOLD),
+    DiagnosticReport(),
+    UNRENDERED_REPORT_KEY};
+}
 
-  size_t responder_monitorings_window_size = 2 * pollRate / respondersNames.size();
+//-----------------------------------------------------------------------------
+std::vector<RTLSTransceiversDiagnostics::CachedReport>
+RTLSTransceiversDiagnostics::makeCachedReports_(
+  const std::vector<std::string> & transceiversNames)
+{
+  std::vector<CachedReport> cachedReports;
+  for (const std::string & transceiverName : transceiversNames) {
+    cachedReports.push_back(makeCachedReport_(transceiverName));
+  }
+  return cachedReports;
+}
 
-  for (const std::string & responderName : respondersNames) {
-    auto monitoring = std::make_unique<OnlineAverage>(
-      AVERAGE_MONITORING_PRECISION,
-      responder_monitorings_window_size);
+//-----------------------------------------------------------------------------
+size_t RTLSTransceiversDiagnostics::addResponder(const std::string & responderName)
+{
+  std::lock_guard<std::mutex> lock(updateMutex_);
 
-    auto diagnostic = std::make_unique<CheckupReliability>(
-      responderName,
-      DEFAULT_LOW_RELIABILITY_THRESHOLD,
-      DEFAULT_HIGH_RELIABILITY_THRESHOLD);
+  // a full store is copied into a larger one and published, previous stores are
+  // kept alive because readers may still hold them (capacity doubles so they
+  // never take more memory than the current one)
+  RTLSReliabilityStore * respondersReliabilities = respondersReliabilities_.load();
+  if (respondersReliabilities->size() == respondersReliabilities->capacity()) {
+    respondersReliabilitiesStores_.push_back(
+      std::make_unique<RTLSReliabilityStore>(
+        *respondersReliabilities,
+        2 * respondersReliabilities->capacity() + 1));
+    respondersReliabilities = respondersReliabilitiesStores_.back().get();
+    respondersReliabilities_.store(respondersReliabilities);
+  }
+  size_t responderIndex = respondersReliabilities->add();
+  linksQualities_.resize(linksQualities_.size() + numberOfInitiators_, 1.0);
+  rangesStatistics_.addResponder();
 
-    responderReliabilityMonitorings_.push_back(std::move(monitoring));
-    responderReliabilityDiagnostics_.push_back(std::move(diagnostic));
+  std::lock_guard<std::mutex> reportsLock(reportsMutex_);
+  respondersReports_.push_back(makeCachedReport_(responderName));
+  return responderIndex;
+}
+
+//-----------------------------------------------------------------------------
+void RTLSTransceiversDiagnostics::update(
+  const size_t & initiatorsPollIndex,
+  const size_t & respondersPollIndex,
+  const RTLSTransceiverRangingResult & rangingResult,
+  const TimePoint & stamp)
+{
+  // a failure is not necessarily the initiator's fault whereas a silent
+  // responder must be able to fall below low reliability threshold
+  bool isSuccessful = !isEmpty(rangingResult);
+  uint8_t initiatorScore = isSuccessful ? SUCCESS_SCORE : INITIATOR_FAILURE_SCORE;
+  uint8_t responderScore = isSuccessful ? SUCCESS_SCORE : RESPONDER_FAILURE_SCORE;
+
+  std::lock_guard<std::mutex> lock(updateMutex_);
+  double & linkQuality = linksQualities_[respondersPollIndex * numberOfInitiators_ +
+      initiatorsPollIndex];
+  linkQuality += LINK_QUALITY_SMOOTHING_FACTOR * (isSuccessful - linkQuality);
+  if (isSuccessful) {
+    rangesStatistics_.update(
+      initiatorsPollIndex, respondersPollIndex, rangingResult.range, stamp);
   }
+
+  initiatorsReliabilities_.update(initiatorsPollIndex, initiatorScore);
+  respondersReliabilities_.load(std::memory_order_relaxed)->update(
+    respondersPollIndex, responderScore);
 }
 
 //-----------------------------------------------------------------------------
-void RTLSTransceiversDiagnostics::initInitiatorsDiagnostics_(
-  const double & pollRate,
-  const std::vector<std::string> & initiatorsNames)
+bool RTLSTransceiversDiagnostics::refreshReport_(
+  CachedReport & cachedReport,
+  const RTLSReliabilityStore & reliabilities,
+  const size_t & transceiverIndex) const
 {
-  initiatorReliabilityMonitorings_.clear();
-  initiatorReliabilityDiagnostics_.clear();
+  RTLSTransceiverReliability reliability = reliabilities.load(transceiverIndex);
+  uint32_t key = reportKey(reliability);
+  if (key == cachedReport.key) {
+    return false;
+  }
 
-  size_t initiator_monitorings_window_size = 2 * pollRate / initiatorsNames.size();
+  if (reliability.status != DiagnosticStatus::STALE) {
+    cachedReport.diagnostic->evaluate(reliability.reliability);
+  }
+  cachedReport.report = cachedReport.diagnostic->getReport();
+  cachedReport.key = key;
+  ++numberOfRenderedReports_;
+  return true;
+}
 
-  for (const std::string & initiator_name : initiatorsNames) {
-    auto monitoring = std::make_unique<OnlineAverage>(
-      AVERAGE_MONITORING_PRECISION,
-      initiator_monitorings_window_size);
+//-----------------------------------------------------------------------------
+DiagnosticReport RTLSTransceiversDiagnostics::getInitiatorReport(const size_t & initiatorIndex)
+const
+{
+  std::lock_guard<std::mutex> lock(reportsMutex_);
+  CachedReport & cachedReport = initiatorsReports_[initiatorIndex];
+  refreshReport_(cachedReport, initiatorsReliabilities_, initiatorIndex);
+  return cachedReport.report;
+}
 
-    auto diagnostic = std::make_unique<CheckupReliability>(
-      initiator_name,
-      DEFAULT_LOW_RELIABILITY_THRESHOLD,
-      DEFAULT_HIGH_RELIABILITY_THRESHOLD);
+//-----------------------------------------------------------------------------
+DiagnosticReport RTLSTransceiversDiagnostics::getResponderReport(const size_t & responderIndex)
+const
+{
+  std::lock_guard<std::mutex> lock(reportsMutex_);
+  CachedReport & cachedReport = respondersReports_[responderIndex];
+  refreshReport_(cachedReport, *respondersReliabilities_.load(), responderIndex);
+  return cachedReport.report;
+}
 
-    initiatorReliabilityMonitorings_.push_back(std::move(monitoring));
-    initiatorReliabilityDiagnostics_.push_back(std::move(diagnostic));
+//-----------------------------------------------------------------------------
+DiagnosticReport RTLSTransceiversDiagnostics::getReport() const
+{
+  std::lock_guard<std::mutex> lock(reportsMutex_);
+  if (allRespondersIndexes_.size() != respondersReports_.size()) {
+    allRespondersIndexes_.resize(respondersReports_.size());
+    std::iota(allRespondersIndexes_.begin(), allRespondersIndexes_.end(), 0);
   }
+  return getReport_(allRespondersIndexes_);
 }
 
 //-----------------------------------------------------------------------------
-void RTLSTransceiversDiagnostics::update(
-  const size_t & initiatorsPollIndex,
-  const size_t & respondersPollIndex,
-  const RTLSTransceiverRangingResult & rangingResult)
+DiagnosticReport RTLSTransceiversDiagnostics::getReport(
+  const std::vector<size_t> & respondersIndexes) const
 {
-  assert(!initiatorReliabilityMonitorings_.empty());
-  assert(!responderReliabilityMonitorings_.empty());
+  std::lock_guard<std::mutex> lock(reportsMutex_);
+  return getReport_(respondersIndexes);
+}
 
-  if (!isEmpty(rangingResult)) {
-    updateInitiatorReliability_(1, initiatorsPollIndex);
-    updateResponderReliability_(1, respondersPollIndex);
-  } else {
-    updateInitiatorReliability_(1 / 3., initiatorsPollIndex);
-    updateResponderReliability_(1 / 3., respondersPollIndex);
+//-----------------------------------------------------------------------------
+DiagnosticReport RTLSTransceiversDiagnostics::getReport_(
+  const std::vector<size_t> & respondersIndexes) const
+{
+  bool isReportChanged = respondersIndexes != reportRespondersIndexes_;
+
+  for (size_t i = 0; i < initiatorsReports_.size(); ++i) {
+    isReportChanged |= refreshReport_(initiatorsReports_[i], initiatorsReliabilities_, i);
+  }
+
+  const RTLSReliabilityStore & respondersReliabilities = *respondersReliabilities_.load();
+  for (const size_t & responderIndex : respondersIndexes) {
+    isReportChanged |= refreshReport_(
+      respondersReports_[responderIndex], respondersReliabilities, responderIndex);
+  }
+
+  // aggregated report is only concatenated again when one of its parts changed
+  if (isReportChanged) {
+    report_ = DiagnosticReport();
+    for (const CachedReport & cachedReport : initiatorsReports_) {
+      report_ += cachedReport.report;
+    }
+    for (const size_t & responderIndex : respondersIndexes) {
+      report_ += respondersReports_[responderIndex].report;
+    }
+    reportRespondersIndexes_ = respondersIndexes;
   }
+  return report_;
 }
 
+//-----------------------------------------------------------------------------
+void RTLSTransceiversDiagnostics::getInitiatorsReliabilities(
+  std::vector<RTLSTransceiverReliability> & reliabilities) const
+{
+  reliabilities.resize(initiatorsReliabilities_.size());
+  for (size_t i = 0; i < reliabilities.size(); ++i) {
+    reliabilities[i] = initiatorsReliabilities_.load(i);
+  }
+}
 
 //-----------------------------------------------------------------------------
-void RTLSTransceiversDiagnostics::updateInitiatorReliability_(
-  const double & reliability,
-  const size_t & initiator_index)
+void RTLSTransceiversDiagnostics::getRespondersReliabilities(
+  std::vector<RTLSTransceiverReliability> & reliabilities) const
 {
-  initiatorReliabilityMonitorings_[initiator_index]->update(reliability);
-  initiatorReliabilityDiagnostics_[initiator_index]->evaluate(
-    initiatorReliabilityMonitorings_[initiator_index]->getAverage());
+  const RTLSReliabilityStore & respondersReliabilities = *respondersReliabilities_.load();
+  reliabilities.resize(respondersReliabilities.size());
+  for (size_t r = 0; r < reliabilities.size(); ++r) {
+    reliabilities[r] = respondersReliabilities.load(r);
+  }
 }
 
 //-----------------------------------------------------------------------------
-void RTLSTransceiversDiagnostics::updateResponderReliability_(
-  const double & reliability,
-  const size_t & responder_index)
+size_t RTLSTransceiversDiagnostics::getNumberOfRenderedReports() const
 {
-  responderReliabilityMonitorings_[responder_index]->update(reliability);
-  responderReliabilityDiagnostics_[responder_index]->evaluate(
-    responderReliabilityMonitorings_[responder_index]->getAverage());
+  std::lock_guard<std::mutex> lock(reportsMutex_);
+  return numberOfRenderedReports_;
 }
 
 //-----------------------------------------------------------------------------
-DiagnosticReport RTLSTransceiversDiagnostics::getInitiatorReport(const size_t & initiatorIndex)
-const
+double RTLSTransceiversDiagnostics::getLinkQuality(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex) const
 {
-  return initiatorReliabilityDiagnostics_[initiatorIndex]->getReport();
+  std::lock_guard<std::mutex> lock(updateMutex_);
+  assert(initiatorIndex < numberOfInitiators_);
+  return linksQualities_[responderIndex * numberOfInitiators_ + initiatorIndex];
 }
 
 //-----------------------------------------------------------------------------
-DiagnosticReport RTLSTransceiversDiagnostics::getResponderReport(const size_t & responderIndex)
-const
+Eigen::MatrixXd RTLSTransceiversDiagnostics::getLinksQualities() const
+{
+  std::lock_guard<std::mutex> lock(updateMutex_);
+  // stored responder major, that is column major with one row per initiator
+  return Eigen::Map<const Eigen::MatrixXd>(
+    linksQualities_.data(), numberOfInitiators_, linksQualities_.size() / numberOfInitiators_);
+}
+
+//-----------------------------------------------------------------------------
+double RTLSTransceiversDiagnostics::getResponderBestLinkQuality(
+  const size_t & responderIndex) const
+{
+  std::lock_guard<std::mutex> lock(updateMutex_);
+  auto first = linksQualities_.begin() + responderIndex * numberOfInitiators_;
+  return *std::max_element(first, first + numberOfInitiators_);
+}
+
+//-----------------------------------------------------------------------------
+RTLSLinkRangeStatistics RTLSTransceiversDiagnostics::getLinkRangeStatistics(
+  const size_t & initiatorIndex,
+  const size_t & responderIndex) const
+{
+  std::lock_guard<std::mutex> lock(updateMutex_);
+  return rangesStatistics_.get(initiatorIndex, responderIndex);
+}
+
+//-----------------------------------------------------------------------------
+void RTLSTransceiversDiagnostics::getRangesWeights(
+  const size_t & initiatorIndex,
+  std::vector<double> & weights) const
+{
+  std::lock_guard<std::mutex> lock(updateMutex_);
+  rangesStatistics_.getRangesWeights(initiatorIndex, weights);
+}
+
+//-----------------------------------------------------------------------------
+bool RTLSTransceiversDiagnostics::isResponderReliable(const size_t & responderIndex) const
 {
-  return responderReliabilityDiagnostics_[responderIndex]->getReport();
+  return respondersReliabilities_.load()->getStatus(responderIndex) != DiagnosticStatus::ERROR;
 }
 
 }  // namespace core
@@ -0,0 +1,158 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <vector>
+
+// romea
+#include "romea_core_rtls/coordination/RTLSVirtualClock.hpp"
+
+namespace romea
+{
+namespace core
+{
+
+class RTLSVirtualClock::Ticker : public RTLSTicker
+{
+public:
+  Ticker(RTLSVirtualClock * clock, TickCallback tickCallback, const Duration & period)
+  : clock_(clock),
+    tickCallback_(tickCallback),
+    period_(period),
+    isRunning_(false),
+    nextTickStamp_()
+  {
+    assert(period > Duration::zero());
+    clock_->registerTicker_(this);
+  }
+
+  ~Ticker() override
+  {
+    clock_->unregisterTicker_(this);
+  }
+
+  void start() override
+  {
+    std::lock_guard<std::mutex> lock(clock_->mutex_);
+    isRunning_ = true;
+    nextTickStamp_ = clock_->now_ + period_;
+  }
+
+  void stop() override
+  {
+    std::lock_guard<std::mutex> lock(clock_->mutex_);
+    isRunning_ = false;
+  }
+
+  RTLSVirtualClock * clock_;
+  TickCallback tickCallback_;
+  Duration period_;
+  bool isRunning_;
+  TimePoint nextTickStamp_;
+};
+
+//-----------------------------------------------------------------------------
+RTLSVirtualClock::RTLSVirtualClock(const TimePoint & startStamp)
+: mutex_(),
+  now_(startStamp),
+  tickers_()
+{
+}
+
+//-----------------------------------------------------------------------------
+RTLSVirtualClock::~RTLSVirtualClock()
+{
+  assert(tickers_.empty());
+}
+
+//-----------------------------------------------------------------------------
+TimePoint RTLSVirtualClock::now() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return now_;
+}
+
+//-----------------------------------------------------------------------------
+std::unique_ptr<RTLSTicker> RTLSVirtualClock::createTicker(
+  TickCallback tickCallback,
+  const Duration & period)
+{
+  return std::make_unique<Ticker>(this, tickCallback, period);
+}
+
+//-----------------------------------------------------------------------------
+void RTLSVirtualClock::advance(const Duration & duration)
+{
+  advanceTo(now() + duration);
+}
+
+//-----------------------------------------------------------------------------
+void RTLSVirtualClock::advanceTo(const TimePoint & stamp)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  assert(stamp >= now_);
+
+  // callbacks are called unlocked so that they can read clock or start and stop tickers
+  while (Ticker * ticker = findNextTicker_(stamp)) {
+    now_ = ticker->nextTickStamp_;
+    ticker->nextTickStamp_ += ticker->period_;
+    TickCallback tickCallback = ticker->tickCallback_;
+    lock.unlock();
+    tickCallback();
+    lock.lock();
+  }
+  now_ = stamp;
+}
+
+//-----------------------------------------------------------------------------
+TimePoint RTLSVirtualClock::getNextTickStamp() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  Ticker * ticker = findNextTicker_(TimePoint::max());
+  return ticker ? ticker->nextTickStamp_ : TimePoint::max();
+}
+
+//-----------------------------------------------------------------------------
+RTLSVirtualClock::Ticker * RTLSVirtualClock::findNextTicker_(const TimePoint & stamp) const
+{
+  Ticker * nextTicker = nullptr;
+  for (Ticker * ticker : tickers_) {
+    if (ticker->isRunning_ && ticker->nextTickStamp_ <= stamp &&
+      (!nextTicker || ticker->nextTickStamp_ < nextTicker->nextTickStamp_))
+    {
+      nextTicker = ticker;
+    }
+  }
+  return nextTicker;
+}
+
+//-----------------------------------------------------------------------------
+void RTLSVirtualClock::registerTicker_(Ticker * ticker)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  tickers_.push_back(ticker);
+}
+
+//-----------------------------------------------------------------------------
+void RTLSVirtualClock::unregisterTicker_(Ticker * ticker)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  tickers_.erase(std::remove(tickers_.begin(), tickers_.end(), ticker), tickers_.end());
+}
+
+}  // namespace core
+}  // namespace romea
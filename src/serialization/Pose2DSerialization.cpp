@@ -15,14 +15,62 @@
 
 // std
 #include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
 #include <exception>
+#include <stdexcept>
 #include <vector>
 
 // romea
 #include "romea_core_common/math/EulerAngles.hpp"
 #include "romea_core_common/geometry/Pose2D.hpp"
+#include "romea_core_rtls/serialization/LittleEndian.hpp"
+#include "romea_core_rtls/serialization/Pose2DSerialization.hpp"
+#include "romea_core_rtls/serialization/Quantization.hpp"
 
 
+namespace
+{
+// poses fields of a chunk fit in a few kilobytes of stack
+const size_t BATCH_CHUNK_SIZE = 64;
+
+//-----------------------------------------------------------------------------
+void checkPose2DBatch(const romea::core::Pose2D * poses, const size_t & numberOfPoses)
+{
+  bool arePositionsSerializable = true;
+  bool arePositionCovariancesSerializable = true;
+  bool areOrientationVariancesSerializable = true;
+  for (size_t n = 0; n < numberOfPoses; ++n) {
+    const romea::core::Pose2D & pose = poses[n];
+    arePositionsSerializable &=
+      romea::core::isSerializableCartesianCoordinate(pose.position.x()) &
+      romea::core::isSerializableCartesianCoordinate(pose.position.y());
+    arePositionCovariancesSerializable &=
+      romea::core::isSerializableCentimetricStd(std::sqrt(pose.covariance(0, 0))) &
+      romea::core::isSerializableCentimetricStd(std::sqrt(pose.covariance(1, 1)));
+    areOrientationVariancesSerializable &=
+      romea::core::isSerializableOrientationVariance(pose.covariance(2, 2));
+  }
+
+  if (!arePositionsSerializable) {
+    throw std::runtime_error(
+            "Cannot serialize cartesian coordinate because it's value is greater than 1000km");
+  }
+
+  if (!arePositionCovariancesSerializable) {
+    throw std::runtime_error(
+            "Cannot serialize position covariance because one of variance value is greater than 4");
+  }
+
+  if (!areOrientationVariancesSerializable) {
+    throw std::runtime_error(
+            "Cannot serialize orientation variance because it's value is greater than 0.2");
+  }
+}
+
+}  // namespace
+
 namespace romea
 {
 namespace core
@@ -31,18 +79,18 @@ namespace core
 //-----------------------------------------------------------------------------
 void serializeCartesianCoordinate(const double & value, unsigned char * buffer)
 {
-  if (std::abs(value) > 1000000) {
+  if (!isSerializableCartesianCoordinate(value)) {
     throw std::runtime_error(
             "Cannot serialize cartesian coordinate because it's value is greater than 1000km");
   }
 
-  *reinterpret_cast<uint32_t *>(buffer) = static_cast<uint32_t>(value * 1000) + 2147483648;
+  storeLittleEndian(quantizeCartesianCoordinate(value), buffer);
 }
 
 //-----------------------------------------------------------------------------
 void deserializeCartesianCoordinate(const unsigned char * buffer, double & value)
 {
-  value = (*reinterpret_cast<const uint32_t *>(buffer) - 2147483648) / 1000.;
+  value = dequantizeCartesianCoordinate(loadLittleEndianUint32(buffer));
 }
 
 //-----------------------------------------------------------------------------
@@ -54,15 +102,15 @@ void serializeWGS84Coordinate(double & value, unsigned char * buffer)
   uint16_t degrees = angleInDegree;
   uint16_t minutes = (angleInDegree - degrees) * 60;
   uint16_t seconds = ((angleInDegree - degrees) * 60 - minutes) * 60000;
-  *reinterpret_cast<uint16_t *>(buffer) = degrees * 60 + minutes;
-  *reinterpret_cast<uint16_t *>(buffer + 2) = seconds;
+  storeLittleEndian(static_cast<uint16_t>(degrees * 60 + minutes), buffer);
+  storeLittleEndian(seconds, buffer + 2);
 }
 
 //-----------------------------------------------------------------------------
 void deserializeWGS84Coordinate(const unsigned char * buffer, double & value)
 {
-  uint16_t seconds = *reinterpret_cast<const uint16_t *>(buffer + 2);
-  uint16_t minutes = *reinterpret_cast<const uint16_t *>(buffer);
+  uint16_t seconds = loadLittleEndianUint16(buffer + 2);
+  uint16_t minutes = loadLittleEndianUint16(buffer);
   uint16_t degrees = minutes % 60;
 
   double angleInDegree = (degrees + (minutes - degrees * 60) / 60. + seconds / 3600000.);
@@ -72,29 +120,29 @@ void deserializeWGS84Coordinate(const unsigned char * buffer, double & value)
 //-----------------------------------------------------------------------------
 void serialiazeOrientation(const double & value, unsigned char * buffer)
 {
-  *reinterpret_cast<uint16_t *>(buffer) = (value / M_PI) * 18000 + 18000;
+  storeLittleEndian(quantizeOrientation(value), buffer);
 }
 
 //-----------------------------------------------------------------------------
 void deserializeOrientation(const unsigned char * buffer, double & value)
 {
-  value = (*reinterpret_cast<const uint16_t *>(buffer) - 18000) * M_PI / 18000.;
+  value = dequantizeOrientation(loadLittleEndianUint16(buffer));
 }
 
 //-----------------------------------------------------------------------------
 void serializeOrientationVariance(const double & value, unsigned char * buffer)
 {
-  if (value > 0.199) {
+  if (!isSerializableOrientationVariance(value)) {
     throw std::runtime_error(
             "Cannot serialize orientation variance because it's value is greater than 0.2");
   }
-  *buffer = std::ceil(std::sqrt(value) / M_PI * 1800);
+  *buffer = quantizeOrientationVariance(value);
 }
 
 //-----------------------------------------------------------------------------
 void deserializeOrientationVariance(const unsigned char * buffer, double & value)
 {
-  value = std::pow((*buffer * M_PI) / 1800., 2);
+  value = dequantizeOrientationVariance(*buffer);
 }
 
 //-----------------------------------------------------------------------------
@@ -120,14 +168,16 @@ void serializePositionCovariance(
   const Eigen::Ref<const Eigen::Matrix2d> & covariance,
   unsigned char * buffer)
 {
-  double std = std::max(std::sqrt(covariance(0, 0)), std::sqrt(covariance(1, 1)));
+  // stds are checked separately because std::max would drop a not a number second argument
+  double xStd = std::sqrt(covariance(0, 0));
+  double yStd = std::sqrt(covariance(1, 1));
 
-  if (std::abs(std) > 2.) {
+  if (!isSerializableCentimetricStd(xStd) || !isSerializableCentimetricStd(yStd)) {
     throw std::runtime_error(
             "Cannot serialize position covariance because one of variance value is greater than 4");
   }
 
-  *buffer = std::ceil(std * 100);
+  *buffer = quantizeCentimetricStd(std::max(xStd, yStd));
 }
 
 //-----------------------------------------------------------------------------
@@ -135,32 +185,148 @@ void deserializePositionCovariance(
   const unsigned char * buffer,
   Eigen::Ref<Eigen::Matrix2d> covariance)
 {
-  double std = *buffer / 100.;
-  covariance = Eigen::Matrix2d::Identity() * std * std;
+  covariance = Eigen::Matrix2d::Identity() * dequantizeCentimetricVariance(*buffer);
+}
+
+
+//-----------------------------------------------------------------------------
+void serializePose2D(const Pose2D & pose, unsigned char * buffer)
+{
+  serializeCartesianPosition(pose.position, buffer);
+  serialiazeOrientation(pose.yaw, buffer + 8);
+  serializePositionCovariance(pose.covariance.block<2, 2>(0, 0), buffer + 10);
+  serializeOrientationVariance(pose.covariance(2, 2), buffer + 11);
 }
 
+//-----------------------------------------------------------------------------
+void deserializePose2D(const unsigned char * buffer, Pose2D & pose)
+{
+  // cross covariances are not serialized and must not be left from a previous pose
+  pose.covariance.setZero();
+  deserializeCartesianPosition(buffer, pose.position);
+  deserializeOrientation(buffer + 8, pose.yaw);
+  deserializePositionCovariance(buffer + 10, pose.covariance.block<2, 2>(0, 0));
+  deserializeOrientationVariance(buffer + 11, pose.covariance(2, 2));
+}
 
 //-----------------------------------------------------------------------------
 std::vector<unsigned char> serializePose2D(const Pose2D & pose)
 {
-  std::vector<unsigned char> buffer(12);
-  serializeCartesianPosition(pose.position, buffer.data());
-  serialiazeOrientation(pose.yaw, buffer.data() + 8);
-  serializePositionCovariance(pose.covariance.block<2, 2>(0, 0), buffer.data() + 10);
-  serializeOrientationVariance(pose.covariance(2, 2), buffer.data() + 11);
+  std::vector<unsigned char> buffer(POSE2D_SERIALIZED_SIZE);
+  serializePose2D(pose, buffer.data());
   return buffer;
 }
 
 //-----------------------------------------------------------------------------
 Pose2D deserializePose2D(const std::vector<uint8_t> & buffer)
 {
+  assert(buffer.size() >= POSE2D_SERIALIZED_SIZE);
   Pose2D pose;
-  deserializeCartesianPosition(buffer.data(), pose.position);
-  deserializeOrientation(buffer.data() + 8, pose.yaw);
-  deserializePositionCovariance(buffer.data() + 10, pose.covariance.block<2, 2>(0, 0));
-  deserializeOrientationVariance(buffer.data() + 11, pose.covariance(2, 2));
+  deserializePose2D(buffer.data(), pose);
   return pose;
 }
 
+//-----------------------------------------------------------------------------
+void serializePose2D(const Pose2D & pose, SerializedPose2D & buffer)
+{
+  serializePose2D(pose, buffer.data());
+}
+
+//-----------------------------------------------------------------------------
+Pose2D deserializePose2D(const SerializedPose2D & buffer)
+{
+  Pose2D pose;
+  deserializePose2D(buffer.data(), pose);
+  return pose;
+}
+
+//-----------------------------------------------------------------------------
+void serializePose2DBatch(
+  const Pose2D * poses,
+  const size_t & numberOfPoses,
+  unsigned char * buffer)
+{
+  // every pose is checked before the first chunk is written so that a batch that throws
+  // leaves buffer untouched
+  checkPose2DBatch(poses, numberOfPoses);
+
+  // fields are gathered by chunks so that quantization kernels run over contiguous arrays
+  std::array<double, BATCH_CHUNK_SIZE> xs, ys, yaws, positionStds, orientationVariances;
+  std::array<uint32_t, BATCH_CHUNK_SIZE> xCodes, yCodes;
+  std::array<uint16_t, BATCH_CHUNK_SIZE> yawCodes;
+  std::array<uint8_t, BATCH_CHUNK_SIZE> positionStdCodes, orientationVarianceCodes;
+
+  for (size_t first = 0; first < numberOfPoses; first += BATCH_CHUNK_SIZE) {
+    size_t size = std::min(BATCH_CHUNK_SIZE, numberOfPoses - first);
+    for (size_t n = 0; n < size; ++n) {
+      const Pose2D & pose = poses[first + n];
+      xs[n] = pose.position.x();
+      ys[n] = pose.position.y();
+      yaws[n] = pose.yaw;
+      positionStds[n] = std::max(
+        std::sqrt(pose.covariance(0, 0)), std::sqrt(pose.covariance(1, 1)));
+      orientationVariances[n] = pose.covariance(2, 2);
+    }
+
+    quantizeCartesianCoordinates(xs.data(), size, xCodes.data());
+    quantizeCartesianCoordinates(ys.data(), size, yCodes.data());
+    quantizeOrientations(yaws.data(), size, yawCodes.data());
+    quantizeCentimetricStds(positionStds.data(), size, positionStdCodes.data());
+    quantizeOrientationVariances(
+      orientationVariances.data(), size, orientationVarianceCodes.data());
+
+    unsigned char * poseBuffer = buffer + first * POSE2D_SERIALIZED_SIZE;
+    for (size_t n = 0; n < size; ++n, poseBuffer += POSE2D_SERIALIZED_SIZE) {
+      storeLittleEndian(xCodes[n], poseBuffer);
+      storeLittleEndian(yCodes[n], poseBuffer + 4);
+      storeLittleEndian(yawCodes[n], poseBuffer + 8);
+      poseBuffer[10] = positionStdCodes[n];
+      poseBuffer[11] = orientationVarianceCodes[n];
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void deserializePose2DBatch(
+  const unsigned char * buffer,
+  const size_t & numberOfPoses,
+  Pose2D * poses)
+{
+  std::array<uint32_t, BATCH_CHUNK_SIZE> xCodes, yCodes;
+  std::array<uint16_t, BATCH_CHUNK_SIZE> yawCodes;
+  std::array<uint8_t, BATCH_CHUNK_SIZE> positionVarianceCodes, orientationVarianceCodes;
+  std::array<double, BATCH_CHUNK_SIZE> xs, ys, yaws, positionVariances, orientationVariances;
+
+  for (size_t first = 0; first < numberOfPoses; first += BATCH_CHUNK_SIZE) {
+    size_t size = std::min(BATCH_CHUNK_SIZE, numberOfPoses - first);
+    const unsigned char * poseBuffer = buffer + first * POSE2D_SERIALIZED_SIZE;
+    for (size_t n = 0; n < size; ++n, poseBuffer += POSE2D_SERIALIZED_SIZE) {
+      xCodes[n] = loadLittleEndianUint32(poseBuffer);
+      yCodes[n] = loadLittleEndianUint32(poseBuffer + 4);
+      yawCodes[n] = loadLittleEndianUint16(poseBuffer + 8);
+      positionVarianceCodes[n] = poseBuffer[10];
+      orientationVarianceCodes[n] = poseBuffer[11];
+    }
+
+    dequantizeCartesianCoordinates(xCodes.data(), size, xs.data());
+    dequantizeCartesianCoordinates(yCodes.data(), size, ys.data());
+    dequantizeOrientations(yawCodes.data(), size, yaws.data());
+    dequantizeCentimetricVariances(positionVarianceCodes.data(), size, positionVariances.data());
+    dequantizeOrientationVariances(
+      orientationVarianceCodes.data(), size, orientationVariances.data());
+
+    for (size_t n = 0; n < size; ++n) {
+      Pose2D & pose = poses[first + n];
+      pose.position.x() = xs[n];
+      pose.position.y() = ys[n];
+      pose.yaw = yaws[n];
+      pose.covariance.setZero();
+      pose.covariance(0, 0) = positionVariances[n];
+      pose.covariance(1, 1) = positionVariances[n];
+      pose.covariance(2, 2) = orientationVariances[n];
+    }
+  }
+}
+
 }  // namespace core
 }  // namespace romea
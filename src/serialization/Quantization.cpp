@@ -0,0 +1,122 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <cmath>
+#include <stdexcept>
+
+// romea
+#include "romea_core_rtls/serialization/Quantization.hpp"
+
+namespace
+{
+// checks are done in a separate pass so that quantization loops have no early exit
+template<typename Predicate>
+bool areAll(const double * values, const size_t & size, Predicate predicate)
+{
+  bool areAll = true;
+  for (size_t n = 0; n < size; ++n) {
+    areAll &= predicate(values[n]);
+  }
+  return areAll;
+}
+
+}  // namespace
+
+namespace romea
+{
+namespace core
+{
+
+//-----------------------------------------------------------------------------
+void quantizeCartesianCoordinates(const double * values, const size_t & size, uint32_t * codes)
+{
+  if (!areAll(values, size, isSerializableCartesianCoordinate)) {
+    throw std::runtime_error(
+            "Cannot serialize cartesian coordinate because it's value is greater than 1000km");
+  }
+
+  for (size_t n = 0; n < size; ++n) {
+    codes[n] = quantizeCartesianCoordinate(values[n]);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void dequantizeCartesianCoordinates(const uint32_t * codes, const size_t & size, double * values)
+{
+  for (size_t n = 0; n < size; ++n) {
+    values[n] = dequantizeCartesianCoordinate(codes[n]);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void quantizeOrientations(const double * values, const size_t & size, uint16_t * codes)
+{
+  for (size_t n = 0; n < size; ++n) {
+    codes[n] = quantizeOrientation(values[n]);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void dequantizeOrientations(const uint16_t * codes, const size_t & size, double * values)
+{
+  for (size_t n = 0; n < size; ++n) {
+    values[n] = dequantizeOrientation(codes[n]);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void quantizeOrientationVariances(const double * variances, const size_t & size, uint8_t * codes)
+{
+  if (!areAll(variances, size, isSerializableOrientationVariance)) {
+    throw std::runtime_error(
+            "Cannot serialize orientation variance because it's value is greater than 0.2");
+  }
+
+  for (size_t n = 0; n < size; ++n) {
+    codes[n] = quantizeOrientationVariance(variances[n]);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void dequantizeOrientationVariances(const uint8_t * codes, const size_t & size, double * variances)
+{
+  for (size_t n = 0; n < size; ++n) {
+    variances[n] = dequantizeOrientationVariance(codes[n]);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void quantizeCentimetricStds(const double * stds, const size_t & size, uint8_t * codes)
+{
+  if (!areAll(stds, size, isSerializableCentimetricStd)) {
+    throw std::runtime_error(
+            "Cannot serialize standard deviation because it's value is greater than 2");
+  }
+
+  for (size_t n = 0; n < size; ++n) {
+    codes[n] = quantizeCentimetricStd(stds[n]);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void dequantizeCentimetricVariances(const uint8_t * codes, const size_t & size, double * variances)
+{
+  for (size_t n = 0; n < size; ++n) {
+    variances[n] = dequantizeCentimetricVariance(codes[n]);
+  }
+}
+
+}  // namespace core
+}  // namespace romea
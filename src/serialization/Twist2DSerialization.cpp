@@ -13,10 +13,13 @@
 // limitations under the License.
 
 // std
+#include <cassert>
 #include <vector>
 #include <exception>
 
 // romea
+#include "romea_core_rtls/serialization/LittleEndian.hpp"
+#include "romea_core_rtls/serialization/Quantization.hpp"
 #include "romea_core_rtls/serialization/Twist2DSerialization.hpp"
 
 namespace romea
@@ -32,13 +35,13 @@ void serializeLinearSpeed(const double & value, unsigned char * buffer)
             "Cannot serialize linear speed because it's value is greater than 100km/h");
   }
 
-  *reinterpret_cast<uint16_t *>(buffer) = static_cast<uint16_t>(value * 1000) + 32768;
+  storeLittleEndian(quantizeLinearSpeed(value), buffer);
 }
 
 //-----------------------------------------------------------------------------
 void deserializeLinearSpeed(const unsigned char * buffer, double & value)
 {
-  value = (*reinterpret_cast<const uint16_t *>(buffer) - 32768) / 1000.0;
+  value = dequantizeLinearSpeed(loadLittleEndianUint16(buffer));
 }
 
 //-----------------------------------------------------------------------------
@@ -51,13 +54,13 @@ void serializeLinearSpeedVariance(const double & value, unsigned char * buffer)
             "Cannot serialize linear speed variance because it's value is greater than 4");
   }
 
-  *buffer = std::ceil(std * 100);
+  *buffer = quantizeCentimetricStd(std);
 }
 
 //-----------------------------------------------------------------------------
 void deserializeLinearSpeedVariance(const unsigned char * buffer, double & value)
 {
-  value = std::pow(*buffer / 100.0, 2);
+  value = dequantizeCentimetricVariance(*buffer);
 }
 
 //-----------------------------------------------------------------------------
@@ -68,13 +71,13 @@ void serializeAngularSpeed(const double & value, unsigned char * buffer)
             "Cannot serialize linear speed because it's value is greater than 180deg/s");
   }
 
-  *reinterpret_cast<uint16_t *>(buffer) = static_cast<uint16_t>(value / M_PI * 18000) + 32768;
+  storeLittleEndian(quantizeAngularSpeed(value), buffer);
 }
 
 //-----------------------------------------------------------------------------
 void deserializeAngularSpeed(const unsigned char * buffer, double & value)
 {
-  value = (*reinterpret_cast<const uint16_t *>(buffer) - 32768) * M_PI / 18000.0;
+  value = dequantizeAngularSpeed(loadLittleEndianUint16(buffer));
 }
 
 //-----------------------------------------------------------------------------
@@ -84,13 +87,13 @@ void serializeAngularSpeedVariance(const double & value, unsigned char * buffer)
     throw std::runtime_error(
             "Cannot serialize orientation variance because it's value is greater than 0.2");
   }
-  *buffer = std::ceil(std::sqrt(value) / M_PI * 1800);
+  *buffer = quantizeOrientationVariance(value);
 }
 
 //-----------------------------------------------------------------------------
 void deserializeAngularSpeedVariance(const unsigned char * buffer, double & value)
 {
-  value = std::pow((*buffer * M_PI) / 1800., 2);
+  value = dequantizeOrientationVariance(*buffer);
 }
 
 //-----------------------------------------------------------------------------
@@ -131,27 +134,78 @@ void deserializeLinearSpeedsCovariance(
   deserializeLinearSpeedVariance(buffer + 1, covariance(1, 1));
 }
 
+//-----------------------------------------------------------------------------
+void serializeTwist2D(const Twist2D & twist, unsigned char * buffer)
+{
+  serializeLinearSpeeds(twist.linearSpeeds, buffer);
+  serializeAngularSpeed(twist.angularSpeed, buffer + 4);
+  serializeLinearSpeedsCovariance(twist.covariance.block<2, 2>(0, 0), buffer + 6);
+  serializeAngularSpeedVariance(twist.covariance(2, 2), buffer + 8);
+}
+
+//-----------------------------------------------------------------------------
+void deserializeTwist2D(const unsigned char * buffer, Twist2D & twist)
+{
+  // cross covariances are not serialized and must not be left from a previous twist
+  twist.covariance.setZero();
+  deserializeLinearSpeeds(buffer, twist.linearSpeeds);
+  deserializeAngularSpeed(buffer + 4, twist.angularSpeed);
+  deserializeLinearSpeedsCovariance(buffer + 6, twist.covariance.block<2, 2>(0, 0));
+  deserializeAngularSpeedVariance(buffer + 8, twist.covariance(2, 2));
+}
+
 //-----------------------------------------------------------------------------
 std::vector<unsigned char> serializeTwist2D(const Twist2D & twist)
 {
-  std::vector<unsigned char> buffer(9);
-  serializeLinearSpeeds(twist.linearSpeeds, buffer.data());
-  serializeAngularSpeed(twist.angularSpeed, buffer.data() + 4);
-  serializeLinearSpeedsCovariance(twist.covariance.block<2, 2>(0, 0), buffer.data() + 6);
-  serializeAngularSpeedVariance(twist.covariance(2, 2), buffer.data() + 8);
+  std::vector<unsigned char> buffer(TWIST2D_SERIALIZED_SIZE);
+  serializeTwist2D(twist, buffer.data());
   return buffer;
 }
 
 //-----------------------------------------------------------------------------
 Twist2D deserializeTwist2D(const std::vector<unsigned char> & buffer)
 {
+  assert(buffer.size() >= TWIST2D_SERIALIZED_SIZE);
   Twist2D twist;
-  deserializeLinearSpeeds(buffer.data(), twist.linearSpeeds);
-  deserializeAngularSpeed(buffer.data() + 4, twist.angularSpeed);
-  deserializeLinearSpeedsCovariance(buffer.data() + 6, twist.covariance.block<2, 2>(0, 0));
-  deserializeAngularSpeedVariance(buffer.data() + 8, twist.covariance(2, 2));
+  deserializeTwist2D(buffer.data(), twist);
   return twist;
 }
 
+//-----------------------------------------------------------------------------
+void serializeTwist2D(const Twist2D & twist, SerializedTwist2D & buffer)
+{
+  serializeTwist2D(twist, buffer.data());
+}
+
+//-----------------------------------------------------------------------------
+Twist2D deserializeTwist2D(const SerializedTwist2D & buffer)
+{
+  Twist2D twist;
+  deserializeTwist2D(buffer.data(), twist);
+  return twist;
+}
+
+//-----------------------------------------------------------------------------
+void serializeTwist2DBatch(
+  const Twist2D * twists,
+  const size_t & numberOfTwists,
+  unsigned char * buffer)
+{
+  for (size_t n = 0; n < numberOfTwists; ++n) {
+    serializeTwist2D(twists[n], buffer + n * TWIST2D_SERIALIZED_SIZE);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void deserializeTwist2DBatch(
+  const unsigned char * buffer,
+  const size_t & numberOfTwists,
+  Twist2D * twists)
+{
+  for (size_t n = 0; n < numberOfTwists; ++n) {
+    deserializeTwist2D(buffer + n * TWIST2D_SERIALIZED_SIZE, twists[n]);
+  }
+}
+
 }  // namespace core
 }  // namespace romea
@@ -0,0 +1,251 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Eigen
+#include <Eigen/LU>
+
+// std
+#include <cassert>
+#include <limits>
+#include <vector>
+
+// romea
+#include "romea_core_rtls/trilateration/RTLSBatchPosition2DEstimator.hpp"
+#include "romea_core_rtls/trilateration/RTLSSimpleTrilateration2D.hpp"
+
+namespace
+{
+const size_t MINIMAL_NUMBER_OF_RANGES_TO_COMPUTE_POSITION = 2;
+const double MINIMAL_DISTANCE_TO_REFERENCE_TAG = 1e-9;
+}
+
+namespace romea
+{
+namespace core
+{
+
+//-----------------------------------------------------------------------------
+RTLSBatchPosition2DEstimator::RTLSBatchPosition2DEstimator(
+  const VectorOfEigenVector3d & referenceTagPositions,
+  const double & estimateEpsilon)
+: estimateEpsilon_(estimateEpsilon),
+  referenceTagPositions_(referenceTagPositions.size()),
+  referenceTagXs_(referenceTagPositions.size()),
+  referenceTagYs_(referenceTagPositions.size()),
+  dataStd_(0)
+{
+  for (size_t n = 0; n < referenceTagPositions.size(); ++n) {
+    referenceTagPositions_[n] = referenceTagPositions[n].head<2>();
+    referenceTagXs_(n) = referenceTagPositions[n].x();
+    referenceTagYs_(n) = referenceTagPositions[n].y();
+  }
+
+  guessRanges_.resize(referenceTagPositions.size());
+  guessIndexesOfAvailableRanges_.reserve(referenceTagPositions.size());
+}
+
+//-----------------------------------------------------------------------------
+bool RTLSBatchPosition2DEstimator::init(const RangeArray & ranges)
+{
+  const Eigen::Index numberOfReferenceTags = referenceTagXs_.size();
+  if (numberOfReferenceTags == 0 || ranges.empty()) {
+    return false;
+  }
+
+  assert(static_cast<Eigen::Index>(ranges.size()) == numberOfReferenceTags);
+  const Eigen::Index numberOfTargetTags = static_cast<Eigen::Index>(ranges[0].size());
+
+  ranges_.setZero(numberOfTargetTags, numberOfReferenceTags);
+  availabilities_.setZero(numberOfTargetTags, numberOfReferenceTags);
+  for (Eigen::Index j = 0; j < numberOfReferenceTags; ++j) {
+    assert(static_cast<Eigen::Index>(ranges[j].size()) == numberOfTargetTags);
+    for (Eigen::Index k = 0; k < numberOfTargetTags; ++k) {
+      const auto & range = ranges[j][k];
+      if (range.has_value()) {
+        ranges_(k, j) = range.value();
+        availabilities_(k, j) = 1;
+      }
+    }
+  }
+
+  Eigen::ArrayXd numberOfAvailableRanges = availabilities_.rowwise().sum();
+  solvables_ = (numberOfAvailableRanges == static_cast<double>(numberOfReferenceTags) ||
+    numberOfAvailableRanges > MINIMAL_NUMBER_OF_RANGES_TO_COMPUTE_POSITION).cast<double>();
+  convergeds_.setZero(numberOfTargetTags);
+  actives_.resize(numberOfTargetTags);
+  divergings_.resize(numberOfTargetTags);
+
+  xs_.resize(numberOfTargetTags);
+  ys_.resize(numberOfTargetTags);
+  dxs_.resize(numberOfTargetTags);
+  dys_.resize(numberOfTargetTags);
+  ds_.resize(numberOfTargetTags);
+  jtjxx_.resize(numberOfTargetTags);
+  jtjxy_.resize(numberOfTargetTags);
+  jtjyy_.resize(numberOfTargetTags);
+  jtyx_.resize(numberOfTargetTags);
+  jtyy_.resize(numberOfTargetTags);
+  correctionXs_.resize(numberOfTargetTags);
+  correctionYs_.resize(numberOfTargetTags);
+  correctionNorms_.resize(numberOfTargetTags);
+  previousCorrectionNorms_.resize(numberOfTargetTags);
+  residuals_.resize(numberOfTargetTags);
+  previousResiduals_.resize(numberOfTargetTags);
+
+  return solvables_.any();
+}
+
+//-----------------------------------------------------------------------------
+bool RTLSBatchPosition2DEstimator::estimate(
+  const size_t & maximalNumberOfIterations,
+  const double & dataStd)
+{
+  dataStd_ = dataStd;
+  computeGuess_();
+
+  convergeds_.setZero();
+  residuals_.setConstant(std::numeric_limits<double>::infinity());
+  correctionNorms_.setConstant(std::numeric_limits<double>::infinity());
+  correctionXs_.setZero();
+  correctionYs_.setZero();
+  for (size_t n = 0; n < maximalNumberOfIterations; ++n) {
+    computeNormalEquations_();
+    computeCorrections_();
+    if ((convergeds_ >= solvables_).all()) {
+      break;
+    }
+  }
+
+  computeNormalEquations_();
+  return solvables_.any() && (convergeds_ >= solvables_).all();
+}
+
+//-----------------------------------------------------------------------------
+void RTLSBatchPosition2DEstimator::computeGuess_()
+{
+  for (Eigen::Index k = 0; k < xs_.size(); ++k) {
+    if (solvables_(k) == 0) {
+      xs_(k) = ys_(k) = 0;
+      continue;
+    }
+
+    guessIndexesOfAvailableRanges_.clear();
+    for (Eigen::Index j = 0; j < referenceTagXs_.size(); ++j) {
+      if (availabilities_(k, j) != 0) {
+        guessIndexesOfAvailableRanges_.push_back(j);
+        guessRanges_[j] = ranges_(k, j);
+      }
+    }
+
+    Eigen::Vector2d guess = SimpleTrilateration2D::computeByLinearLeastSquares(
+      referenceTagPositions_, guessRanges_, guessIndexesOfAvailableRanges_);
+    xs_(k) = guess.x();
+    ys_(k) = guess.y();
+  }
+}
+
+//-----------------------------------------------------------------------------
+void RTLSBatchPosition2DEstimator::computeNormalEquations_()
+{
+  jtjxx_.setZero();
+  jtjxy_.setZero();
+  jtjyy_.setZero();
+  jtyx_.setZero();
+  jtyy_.setZero();
+  previousResiduals_.swap(residuals_);
+  residuals_.setZero();
+
+  for (Eigen::Index j = 0; j < referenceTagXs_.size(); ++j) {
+    dxs_ = xs_ - referenceTagXs_(j);
+    dys_ = ys_ - referenceTagYs_(j);
+    ds_ = (dxs_.square() + dys_.square()).sqrt().max(MINIMAL_DISTANCE_TO_REFERENCE_TAG);
+
+    // jacobian row (dx/d, dy/d) weighted by range availability
+    dxs_ *= availabilities_.col(j) / ds_;
+    dys_ *= availabilities_.col(j) / ds_;
+    ds_ -= ranges_.col(j);
+
+    jtjxx_ += dxs_.square();
+    jtjxy_ += dxs_ * dys_;
+    jtjyy_ += dys_.square();
+    jtyx_ += dxs_ * ds_;
+    jtyy_ += dys_ * ds_;
+    residuals_ += availabilities_.col(j) * ds_.square();
+  }
+}
+
+//-----------------------------------------------------------------------------
+void RTLSBatchPosition2DEstimator::computeCorrections_()
+{
+  // keep last applied corrections in order to undo them for diverging target tags
+  dxs_ = correctionXs_;
+  dys_ = correctionYs_;
+
+  ds_ = jtjxx_ * jtjyy_ - jtjxy_.square();
+  correctionXs_ = (jtjyy_ * jtyx_ - jtjxy_ * jtyy_) / ds_;
+  correctionYs_ = (jtjxx_ * jtyy_ - jtjxy_ * jtyx_) / ds_;
+  previousCorrectionNorms_.swap(correctionNorms_);
+  correctionNorms_ = (correctionXs_.square() + correctionYs_.square()).sqrt();
+
+  // a target tag diverges when its last correction has increased both its sum
+  // of squared residuals and the norm of the next correction
+  actives_ = solvables_ * (1 - convergeds_);
+  divergings_ = (actives_ > 0 && residuals_ > previousResiduals_ &&
+    correctionNorms_ > previousCorrectionNorms_).cast<double>();
+  xs_ = (divergings_ > 0).select(xs_ + dxs_, xs_);
+  ys_ = (divergings_ > 0).select(ys_ + dys_, ys_);
+  solvables_ *= (1 - divergings_) * correctionNorms_.isFinite().cast<double>();
+
+  // unsolvable, converged or diverging target tags are left untouched
+  actives_ = solvables_ * (1 - convergeds_);
+  correctionXs_ = (actives_ > 0).select(correctionXs_, 0);
+  correctionYs_ = (actives_ > 0).select(correctionYs_, 0);
+
+  xs_ -= correctionXs_;
+  ys_ -= correctionYs_;
+
+  convergeds_ = (convergeds_ > 0 ||
+    (actives_ > 0 && correctionNorms_ < estimateEpsilon_)).cast<double>();
+}
+
+//-----------------------------------------------------------------------------
+size_t RTLSBatchPosition2DEstimator::getNumberOfTargetTags() const
+{
+  return static_cast<size_t>(xs_.size());
+}
+
+//-----------------------------------------------------------------------------
+bool RTLSBatchPosition2DEstimator::isEstimated(const size_t & targetTagIndex) const
+{
+  return solvables_(targetTagIndex) != 0 && convergeds_(targetTagIndex) != 0;
+}
+
+//-----------------------------------------------------------------------------
+Eigen::Vector2d RTLSBatchPosition2DEstimator::getEstimate(const size_t & targetTagIndex) const
+{
+  return Eigen::Vector2d(xs_(targetTagIndex), ys_(targetTagIndex));
+}
+
+//-----------------------------------------------------------------------------
+Eigen::Matrix2d RTLSBatchPosition2DEstimator::getEstimateCovariance(
+  const size_t & targetTagIndex) const
+{
+  Eigen::Matrix2d JtJ;
+  JtJ << jtjxx_(targetTagIndex), jtjxy_(targetTagIndex),
+    jtjxy_(targetTagIndex), jtjyy_(targetTagIndex);
+  return JtJ.inverse() * dataStd_ * dataStd_;
+}
+
+}  // namespace core
+}  // namespace romea
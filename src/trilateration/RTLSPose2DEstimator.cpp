@@ -40,7 +40,19 @@ RTLSPose2DEstimator::RTLSPose2DEstimator(
   const VectorOfEigenVector3d & targetTagPositions,
   const VectorOfEigenVector3d & referenceTagPositions,
   const double & estimateEpsilon)
-: NLSE(estimateEpsilon)
+: NLSE(estimateEpsilon),
+  targetTagPositions_(),
+  referenceTagPositions_(),
+  ranges_(),
+  indexesOfAvailableRanges_(),
+  isTrackingEnabled_(false),
+  isTrackingGuessAllowed_(false),
+  isTrackingGuessUsed_(false),
+  isLastEstimateAvailable_(false),
+  maximalGuessResidual_(0),
+  maximalJump_(0),
+  lastEstimate_(Eigen::Vector3d::Zero()),
+  trackingGuess_(Eigen::Vector3d::Zero())
 {
   estimate_.resize(3);
   estimateCovariance_.resize(3, 3);
@@ -189,14 +201,83 @@ bool RTLSPose2DEstimator::init(const RangeArray & ranges)
 // }
 
 
+//-----------------------------------------------------------------------------
+bool RTLSPose2DEstimator::estimate(
+  const size_t & maximalNumberOfIterations,
+  const double & dataStd)
+{
+  isTrackingGuessAllowed_ = isTrackingEnabled_ && isLastEstimateAvailable_;
+  bool success = NLSE::estimate(maximalNumberOfIterations, dataStd);
+
+  if (isTrackingGuessUsed_ &&
+    (!success || (estimate_.head<2>() - trackingGuess_.head<2>()).norm() > maximalJump_))
+  {
+    isTrackingGuessAllowed_ = false;
+    success = NLSE::estimate(maximalNumberOfIterations, dataStd);
+  }
+
+  isLastEstimateAvailable_ = success;
+  lastEstimate_ = estimate_;
+  return success;
+}
+
+//-----------------------------------------------------------------------------
+void RTLSPose2DEstimator::enableTracking(
+  const double & maximalGuessResidual,
+  const double & maximalJump)
+{
+  isTrackingEnabled_ = true;
+  maximalGuessResidual_ = maximalGuessResidual;
+  maximalJump_ = maximalJump;
+}
+
+//-----------------------------------------------------------------------------
+void RTLSPose2DEstimator::disableTracking()
+{
+  isTrackingEnabled_ = false;
+  isLastEstimateAvailable_ = false;
+}
+
+//-----------------------------------------------------------------------------
+void RTLSPose2DEstimator::predict(const Twist2D & twist, const double & dt)
+{
+  double coso = std::cos(lastEstimate_(2));
+  double sino = std::sin(lastEstimate_(2));
+  lastEstimate_(0) += (coso * twist.linearSpeeds.x() - sino * twist.linearSpeeds.y()) * dt;
+  lastEstimate_(1) += (sino * twist.linearSpeeds.x() + coso * twist.linearSpeeds.y()) * dt;
+  lastEstimate_(2) += twist.angularSpeed * dt;
+}
+
+//-----------------------------------------------------------------------------
+bool RTLSPose2DEstimator::isTrackingGuessUsed() const
+{
+  return isTrackingGuessUsed_;
+}
+
+//-----------------------------------------------------------------------------
+bool RTLSPose2DEstimator::computeTrackingGuess_()
+{
+  trackingGuess_ = lastEstimate_;
+  estimate_ = trackingGuess_;
+
+  computeJacobianAndY_();
+  const auto & Y = leastSquares_.getY();
+  return std::sqrt(Y.squaredNorm() / Y.rows()) < maximalGuessResidual_;
+}
+
 //-----------------------------------------------------------------------------
 void RTLSPose2DEstimator::computeGuess_()
 {
+  isTrackingGuessUsed_ = isTrackingGuessAllowed_ && computeTrackingGuess_();
+  if (isTrackingGuessUsed_) {
+    return;
+  }
+
   VectorOfEigenVector2d targetTagGuessPositions(targetTagPositions_.size());
 
   for (size_t i = 0; i < targetTagPositions_.size(); i++) {
-    targetTagGuessPositions[i] = SimpleTrilateration2D::
-      compute(referenceTagPositions_, ranges_[i], indexesOfAvailableRanges_[i]);
+    targetTagGuessPositions[i] = SimpleTrilateration2D::computeByLinearLeastSquares(
+      referenceTagPositions_, ranges_[i], indexesOfAvailableRanges_[i]);
   }
 
   FindRigidTransformationBySVD<Eigen::Vector2d> estimator_;
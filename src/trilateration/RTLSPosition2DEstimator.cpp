@@ -12,13 +12,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include "romea_core_rtls/trilateration/RTLSPosition2DEstimator.hpp"
-#include "romea_core_rtls/trilateration/RTLSSimpleTrilateration2D.hpp"
+// std
+#include <cmath>
 
-namespace
-{
-const size_t MINIMAL_NUMBER_OF_RANGES_TO_COMPUTE_POSITION = 2;
-}
+// romea
+#include "romea_core_rtls/trilateration/RTLSPosition2DEstimator.hpp"
 
 namespace romea
 {
@@ -30,18 +28,16 @@ namespace core
 RTLSPosition2DEstimator::RTLSPosition2DEstimator(
   const VectorOfEigenVector3d & referenceTagPositions,
   const double & estimateEpsilon)
-: NLSE(estimateEpsilon)
+: RTLSPosition2DEstimatorBase(referenceTagPositions, estimateEpsilon),
+  isTrackingEnabled_(false),
+  isTrackingGuessAllowed_(false),
+  isTrackingGuessUsed_(false),
+  isLastEstimateAvailable_(false),
+  maximalGuessResidual_(0),
+  maximalJump_(0),
+  lastEstimate_(Eigen::Vector2d::Zero()),
+  trackingGuess_(Eigen::Vector2d::Zero())
 {
-  estimate_.resize(2);
-  estimateCovariance_.resize(2, 2);
-  leastSquares_.setEstimateSize(2);
-
-  ranges_.resize(referenceTagPositions.size());
-  referenceTagPositions_.resize(referenceTagPositions.size());
-
-  for (size_t n = 0; n < referenceTagPositions.size(); ++n) {
-    referenceTagPositions_[n] = referenceTagPositions[n].head<2>();
-  }
 }
 
 // //-----------------------------------------------------------------------------
@@ -56,31 +52,6 @@ RTLSPosition2DEstimator::RTLSPosition2DEstimator(
 //   }
 // }
 
-//--------------------------------------- --------------------------------------
-bool RTLSPosition2DEstimator::init(const RangeVector & ranges)
-{
-  if (ranges_.empty()) {
-    return false;
-  }
-
-  indexesOfAvailableRanges_.clear();
-  for (size_t n = 0; n < ranges.size(); ++n) {
-    if (ranges[n].has_value()) {
-      indexesOfAvailableRanges_.push_back(n);
-      ranges_[n] = ranges[n].value();
-    }
-  }
-
-  if (indexesOfAvailableRanges_.size() == ranges_.size() ||
-    indexesOfAvailableRanges_.size() > MINIMAL_NUMBER_OF_RANGES_TO_COMPUTE_POSITION)
-  {
-    leastSquares_.setDataSize(indexesOfAvailableRanges_.size());
-    return true;
-  } else {
-    return false;
-  }
-}
-
 // //--------------------------------------- --------------------------------------
 // bool RTLSPosition2DEstimator::init(const RTLSLocalisationRangeVector & ranges)
 // {
@@ -107,31 +78,79 @@ bool RTLSPosition2DEstimator::init(const RangeVector & ranges)
 // }
 
 //-----------------------------------------------------------------------------
-void RTLSPosition2DEstimator::computeGuess_()
+bool RTLSPosition2DEstimator::estimate(
+  const size_t & maximalNumberOfIterations,
+  const double & dataStd)
 {
-  estimate_ = SimpleTrilateration2D::
-    compute(referenceTagPositions_, ranges_, indexesOfAvailableRanges_);
+  isTrackingGuessAllowed_ = isTrackingEnabled_ && isLastEstimateAvailable_;
+  bool success = NLSE::estimate(maximalNumberOfIterations, dataStd);
+
+  if (isTrackingGuessUsed_ &&
+    (!success || (estimate_ - trackingGuess_).norm() > maximalJump_))
+  {
+    isTrackingGuessAllowed_ = false;
+    success = NLSE::estimate(maximalNumberOfIterations, dataStd);
+  }
+
+  isLastEstimateAvailable_ = success;
+  lastEstimate_ = estimate_;
+  return success;
 }
 
 //-----------------------------------------------------------------------------
-void RTLSPosition2DEstimator::computeJacobianAndY_()
+void RTLSPosition2DEstimator::enableTracking(
+  const double & maximalGuessResidual,
+  const double & maximalJump)
 {
-  auto & J = leastSquares_.getJ();
-  auto & Y = leastSquares_.getY();
+  isTrackingEnabled_ = true;
+  maximalGuessResidual_ = maximalGuessResidual;
+  maximalJump_ = maximalJump;
+}
 
-  for (size_t n = 0; n < indexesOfAvailableRanges_.size(); ++n) {
-    size_t rangeIndex = indexesOfAvailableRanges_[n];
-    double dx = estimate_(0) - referenceTagPositions_[rangeIndex].x();
-    double dy = estimate_(1) - referenceTagPositions_[rangeIndex].y();
+//-----------------------------------------------------------------------------
+void RTLSPosition2DEstimator::disableTracking()
+{
+  isTrackingEnabled_ = false;
+  isLastEstimateAvailable_ = false;
+}
 
-    Y(static_cast<int>(n)) = std::sqrt(dx * dx + dy * dy);
+//-----------------------------------------------------------------------------
+void RTLSPosition2DEstimator::predict(
+  const Twist2D & twist,
+  const double & heading,
+  const double & dt)
+{
+  double coso = std::cos(heading);
+  double sino = std::sin(heading);
+  lastEstimate_(0) += (coso * twist.linearSpeeds.x() - sino * twist.linearSpeeds.y()) * dt;
+  lastEstimate_(1) += (sino * twist.linearSpeeds.x() + coso * twist.linearSpeeds.y()) * dt;
+}
 
-    J.row(static_cast<int>(n)) << dx, dy;
-    J.row(static_cast<int>(n)) /= Y(static_cast<int>(n));
+//-----------------------------------------------------------------------------
+bool RTLSPosition2DEstimator::isTrackingGuessUsed() const
+{
+  return isTrackingGuessUsed_;
+}
 
-    Y(static_cast<int>(n)) -= ranges_[rangeIndex];
+//-----------------------------------------------------------------------------
+void RTLSPosition2DEstimator::computeGuess_()
+{
+  isTrackingGuessUsed_ = isTrackingGuessAllowed_ && computeTrackingGuess_();
+  if (!isTrackingGuessUsed_) {
+    RTLSPosition2DEstimatorBase::computeGuess_();
   }
 }
 
+//-----------------------------------------------------------------------------
+bool RTLSPosition2DEstimator::computeTrackingGuess_()
+{
+  trackingGuess_ = lastEstimate_;
+  estimate_ = trackingGuess_;
+
+  computeJacobianAndY_();
+  const auto & Y = leastSquares_.getY();
+  return std::sqrt(Y.squaredNorm() / Y.rows()) < maximalGuessResidual_;
+}
+
 }  // namespace core
 }  // namespace romea
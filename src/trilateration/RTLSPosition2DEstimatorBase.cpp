@@ -0,0 +1,135 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+// romea
+#include "romea_core_rtls/trilateration/RTLSPosition2DEstimatorBase.hpp"
+#include "romea_core_rtls/trilateration/RTLSSimpleTrilateration2D.hpp"
+
+namespace
+{
+const size_t MINIMAL_NUMBER_OF_RANGES_TO_COMPUTE_POSITION = 2;
+}
+
+namespace romea
+{
+namespace core
+{
+
+//-----------------------------------------------------------------------------
+RTLSPosition2DEstimatorBase::RTLSPosition2DEstimatorBase(
+  const VectorOfEigenVector3d & referenceTagPositions,
+  const double & estimateEpsilon)
+: NLSE(estimateEpsilon),
+  referenceTagPositions_(),
+  indexesOfAvailableRanges_(),
+  ranges_(),
+  rangesSqrtWeights_()
+{
+  estimate_.resize(2);
+  estimateCovariance_.resize(2, 2);
+  leastSquares_.setEstimateSize(2);
+
+  ranges_.resize(referenceTagPositions.size());
+  rangesSqrtWeights_.resize(referenceTagPositions.size(), 1.0);
+  referenceTagPositions_.resize(referenceTagPositions.size());
+
+  for (size_t n = 0; n < referenceTagPositions.size(); ++n) {
+    referenceTagPositions_[n] = referenceTagPositions[n].head<2>();
+  }
+
+  indexesOfAvailableRanges_.reserve(referenceTagPositions.size());
+}
+
+//-----------------------------------------------------------------------------
+bool RTLSPosition2DEstimatorBase::init(const RangeVector & ranges)
+{
+  if (ranges_.empty()) {
+    return false;
+  }
+
+  std::fill(rangesSqrtWeights_.begin(), rangesSqrtWeights_.end(), 1.0);
+  indexesOfAvailableRanges_.clear();
+  for (size_t n = 0; n < ranges.size(); ++n) {
+    if (ranges[n].has_value()) {
+      indexesOfAvailableRanges_.push_back(n);
+      ranges_[n] = ranges[n].value();
+    }
+  }
+
+  if (indexesOfAvailableRanges_.size() == ranges_.size() ||
+    indexesOfAvailableRanges_.size() > MINIMAL_NUMBER_OF_RANGES_TO_COMPUTE_POSITION)
+  {
+    leastSquares_.setDataSize(indexesOfAvailableRanges_.size());
+    return true;
+  } else {
+    return false;
+  }
+}
+
+//-----------------------------------------------------------------------------
+bool RTLSPosition2DEstimatorBase::init(
+  const RangeVector & ranges,
+  const std::vector<double> & rangesWeights)
+{
+  assert(rangesWeights.size() == ranges.size());
+  bool isInitialized = init(ranges);
+  for (size_t n = 0; n < ranges_.size() && n < rangesWeights.size(); ++n) {
+    assert(rangesWeights[n] > 0);
+    rangesSqrtWeights_[n] = std::sqrt(rangesWeights[n]);
+  }
+  return isInitialized;
+}
+
+//-----------------------------------------------------------------------------
+void RTLSPosition2DEstimatorBase::computeGuess_()
+{
+  estimate_ = SimpleTrilateration2D::
+    computeByLinearLeastSquares(referenceTagPositions_, ranges_, indexesOfAvailableRanges_);
+}
+
+//-----------------------------------------------------------------------------
+void RTLSPosition2DEstimatorBase::computeJacobianAndY_()
+{
+  auto & J = leastSquares_.getJ();
+  auto & Y = leastSquares_.getY();
+
+  for (size_t n = 0; n < indexesOfAvailableRanges_.size(); ++n) {
+    size_t rangeIndex = indexesOfAvailableRanges_[n];
+    double dx = estimate_(0) - referenceTagPositions_[rangeIndex].x();
+    double dy = estimate_(1) - referenceTagPositions_[rangeIndex].y();
+    double d = std::sqrt(dx * dx + dy * dy);
+
+    double residual = d - ranges_[rangeIndex];
+    double sqrtWeight = rangesSqrtWeights_[rangeIndex] * computeResidualSqrtWeight_(residual);
+
+    J.row(static_cast<int>(n)) << dx, dy;
+    J.row(static_cast<int>(n)) *= sqrtWeight / d;
+    Y(static_cast<int>(n)) = sqrtWeight * residual;
+  }
+}
+
+//-----------------------------------------------------------------------------
+double RTLSPosition2DEstimatorBase::computeResidualSqrtWeight_(const double & /*residual*/) const
+{
+  return 1;
+}
+
+}  // namespace core
+}  // namespace romea
@@ -0,0 +1,188 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+// romea
+#include "romea_core_rtls/trilateration/RTLSRobustPosition2DEstimator.hpp"
+#include "romea_core_rtls/trilateration/RTLSSimpleTrilateration2D.hpp"
+
+namespace
+{
+const size_t MINIMAL_NUMBER_OF_RANGES_TO_COMPUTE_POSITION = 2;
+const size_t MINIMAL_NUMBER_OF_RANGES_TO_REJECT_OUTLIERS = 4;
+const double MINIMAL_WEIGHT = 1e-6;
+}
+
+namespace romea
+{
+namespace core
+{
+
+//-----------------------------------------------------------------------------
+RTLSRobustPosition2DEstimator::RTLSRobustPosition2DEstimator(
+  const VectorOfEigenVector3d & referenceTagPositions,
+  const double & estimateEpsilon,
+  const Loss & loss,
+  const double & lossScale,
+  const double & inlierThreshold,
+  const size_t & maximalNumberOfHypotheses)
+: RTLSPosition2DEstimatorBase(referenceTagPositions, estimateEpsilon),
+  loss_(loss),
+  lossScale_(lossScale),
+  inlierThreshold_(inlierThreshold),
+  maximalNumberOfHypotheses_(maximalNumberOfHypotheses),
+  numberOfEvaluatedHypotheses_(0),
+  inliersIndexes_()
+{
+  inliersIndexes_.reserve(referenceTagPositions.size());
+}
+
+//-----------------------------------------------------------------------------
+bool RTLSRobustPosition2DEstimator::estimate(
+  const size_t & maximalNumberOfIterations,
+  const double & dataStd)
+{
+  inliersIndexes_.clear();
+  if (!NLSE::estimate(maximalNumberOfIterations, dataStd)) {
+    return false;
+  }
+
+  selectInliers_(estimate_);
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+const std::vector<size_t> & RTLSRobustPosition2DEstimator::getInliersIndexes() const
+{
+  return inliersIndexes_;
+}
+
+//-----------------------------------------------------------------------------
+size_t RTLSRobustPosition2DEstimator::getNumberOfEvaluatedHypotheses() const
+{
+  return numberOfEvaluatedHypotheses_;
+}
+
+//-----------------------------------------------------------------------------
+void RTLSRobustPosition2DEstimator::computeGuess_()
+{
+  numberOfEvaluatedHypotheses_ = 0;
+
+  const size_t numberOfRanges = indexesOfAvailableRanges_.size();
+  if (numberOfRanges < MINIMAL_NUMBER_OF_RANGES_TO_REJECT_OUTLIERS) {
+    RTLSPosition2DEstimatorBase::computeGuess_();
+    return;
+  }
+
+  // minimal subsets are pairs of ranges, each one giving two circle intersections,
+  // they are enumerated in a deterministic order until the hypotheses budget is spent
+  Eigen::Vector2d bestHypothesis = Eigen::Vector2d::Zero();
+  size_t bestNumberOfInliers = 0;
+  double bestInliersResidual = std::numeric_limits<double>::max();
+
+  for (size_t gap = 1; gap < numberOfRanges; ++gap) {
+    for (size_t i = 0; i + gap < numberOfRanges; ++i) {
+      if (numberOfEvaluatedHypotheses_ >= maximalNumberOfHypotheses_) {
+        break;
+      }
+
+      const size_t & ri = indexesOfAvailableRanges_[i];
+      const size_t & rj = indexesOfAvailableRanges_[i + gap];
+      std::array<Eigen::Vector2d, 2> hypotheses = SimpleTrilateration2D::computeIntersections(
+        referenceTagPositions_[ri], referenceTagPositions_[rj], ranges_[ri], ranges_[rj]);
+
+      for (const auto & hypothesis : hypotheses) {
+        double inliersResidual;
+        size_t numberOfInliers = countInliers_(hypothesis, inliersResidual);
+        if (numberOfInliers > bestNumberOfInliers ||
+          (numberOfInliers == bestNumberOfInliers && inliersResidual < bestInliersResidual))
+        {
+          bestHypothesis = hypothesis;
+          bestNumberOfInliers = numberOfInliers;
+          bestInliersResidual = inliersResidual;
+        }
+      }
+      ++numberOfEvaluatedHypotheses_;
+    }
+  }
+
+  selectInliers_(bestHypothesis);
+  if (inliersIndexes_.size() > MINIMAL_NUMBER_OF_RANGES_TO_COMPUTE_POSITION) {
+    estimate_ = SimpleTrilateration2D::
+      computeByLinearLeastSquares(referenceTagPositions_, ranges_, inliersIndexes_);
+  } else {
+    estimate_ = bestHypothesis;
+  }
+}
+
+//-----------------------------------------------------------------------------
+double RTLSRobustPosition2DEstimator::computeResidualSqrtWeight_(const double & residual) const
+{
+  return std::sqrt(computeWeight_(residual));
+}
+
+//-----------------------------------------------------------------------------
+double RTLSRobustPosition2DEstimator::computeWeight_(const double & residual) const
+{
+  const double absoluteResidual = std::abs(residual);
+  if (loss_ == Loss::HUBER) {
+    return absoluteResidual <= lossScale_ ? 1 : lossScale_ / absoluteResidual;
+  } else {
+    if (absoluteResidual >= lossScale_) {
+      return MINIMAL_WEIGHT;
+    }
+    double u = 1 - (residual / lossScale_) * (residual / lossScale_);
+    return std::max(u * u, MINIMAL_WEIGHT);
+  }
+}
+
+//-----------------------------------------------------------------------------
+size_t RTLSRobustPosition2DEstimator::countInliers_(
+  const Eigen::Vector2d & position,
+  double & inliersResidual) const
+{
+  size_t numberOfInliers = 0;
+  inliersResidual = 0;
+  for (const size_t & rangeIndex : indexesOfAvailableRanges_) {
+    double residual = std::abs(
+      (position - referenceTagPositions_[rangeIndex]).norm() - ranges_[rangeIndex]);
+    if (residual < inlierThreshold_) {
+      inliersResidual += residual;
+      ++numberOfInliers;
+    }
+  }
+  return numberOfInliers;
+}
+
+//-----------------------------------------------------------------------------
+void RTLSRobustPosition2DEstimator::selectInliers_(const Eigen::Vector2d & position)
+{
+  inliersIndexes_.clear();
+  for (const size_t & rangeIndex : indexesOfAvailableRanges_) {
+    double residual = std::abs(
+      (position - referenceTagPositions_[rangeIndex]).norm() - ranges_[rangeIndex]);
+    if (residual < inlierThreshold_) {
+      inliersIndexes_.push_back(rangeIndex);
+    }
+  }
+}
+
+}  // namespace core
+}  // namespace romea
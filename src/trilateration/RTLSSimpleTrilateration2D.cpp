@@ -26,7 +26,7 @@ namespace core
 {
 
 //-----------------------------------------------------------------------------
-VectorOfEigenVector2d SimpleTrilateration2D::compute_(
+std::array<Eigen::Vector2d, 2> SimpleTrilateration2D::computeIntersections(
   const Eigen::Vector2d & p1,
   const Eigen::Vector2d & p2,
   const double & r1,
@@ -41,7 +41,7 @@ VectorOfEigenVector2d SimpleTrilateration2D::compute_(
   double alpha =
     std::acos(std::max(std::min((base * base + r1 * r1 - r2 * r2) / (2 * base * r1), 1.), -1.));
 
-  VectorOfEigenVector2d solutions(2, p1);
+  std::array<Eigen::Vector2d, 2> solutions = {p1, p1};
   solutions[0].x() += r1 * std::cos(theta + alpha);
   solutions[0].y() += r1 * std::sin(theta + alpha);
   solutions[1].x() += r1 * std::cos(theta - alpha);
@@ -76,7 +76,7 @@ Eigen::Vector2d SimpleTrilateration2D::compute_(
 {
   std::vector<double> errors(2, 0);
 
-  VectorOfEigenVector2d solutions = compute_(
+  std::array<Eigen::Vector2d, 2> solutions = computeIntersections(
     tagPositions[i],
     tagPositions[j],
     ranges[i],
@@ -103,16 +103,17 @@ Eigen::Vector2d SimpleTrilateration2D::compute_(
 {
   std::vector<double> errors(2, 0);
 
-  VectorOfEigenVector2d solutions = compute_(
-    tagPositions[i],
-    tagPositions[j],
+  std::array<Eigen::Vector2d, 2> solutions = computeIntersections(
+    tagPositions[rangesIndexes[i]],
+    tagPositions[rangesIndexes[j]],
     ranges[rangesIndexes[i]],
     ranges[rangesIndexes[j]]);
 
-  size_t k = (j + 1) % ranges.size();
-  for (; k != i; k = (k + 1) % ranges.size()) {
-    errors[0] += std::abs((tagPositions[k] - solutions[0]).norm() - ranges[rangesIndexes[k]]);
-    errors[1] += std::abs((tagPositions[k] - solutions[1]).norm() - ranges[rangesIndexes[k]]);
+  size_t k = (j + 1) % rangesIndexes.size();
+  for (; k != i; k = (k + 1) % rangesIndexes.size()) {
+    const Eigen::Vector2d & tagPosition = tagPositions[rangesIndexes[k]];
+    errors[0] += std::abs((tagPosition - solutions[0]).norm() - ranges[rangesIndexes[k]]);
+    errors[1] += std::abs((tagPosition - solutions[1]).norm() - ranges[rangesIndexes[k]]);
   }
 
   //  std::cout <<" errors "<< errors[0] <<" "<<errors[1]<< std::endl;
@@ -149,7 +150,7 @@ Eigen::Vector2d SimpleTrilateration2D::compute(
   assert(rangesIndexes.size() >= 2);
   assert(tagPositions.size() == ranges.size());
 
-  if (tagPositions.size() == 2) {
+  if (rangesIndexes.size() == 2) {
     return compute_(tagPositions, ranges, rangesIndexes, 0, 1);
   } else {
     Eigen::Vector2d solution = Eigen::Vector2d::Zero();
@@ -161,7 +162,48 @@ Eigen::Vector2d SimpleTrilateration2D::compute(
         i,
         j);
     }
-    return solution / ranges.size();
+    return solution / rangesIndexes.size();
+  }
+}
+
+//-----------------------------------------------------------------------------
+Eigen::Vector2d SimpleTrilateration2D::computeByLinearLeastSquares(
+  const VectorOfEigenVector2d & tagPositions,
+  const std::vector<double> & ranges)
+{
+  assert(tagPositions.size() == ranges.size());
+
+  Eigen::Vector2d solution;
+  if (computeByLinearLeastSquares(
+      ranges.size(),
+      [&](const size_t & n) -> const Eigen::Vector2d & {return tagPositions[n];},
+      [&](const size_t & n) {return ranges[n];},
+      solution))
+  {
+    return solution;
+  } else {
+    return compute(tagPositions, ranges);
+  }
+}
+
+//-----------------------------------------------------------------------------
+Eigen::Vector2d SimpleTrilateration2D::computeByLinearLeastSquares(
+  const VectorOfEigenVector2d & tagPositions,
+  const std::vector<double> & ranges,
+  const std::vector<size_t> & rangesIndexes)
+{
+  assert(tagPositions.size() == ranges.size());
+
+  Eigen::Vector2d solution;
+  if (computeByLinearLeastSquares(
+      rangesIndexes.size(),
+      [&](const size_t & n) -> const Eigen::Vector2d & {return tagPositions[rangesIndexes[n]];},
+      [&](const size_t & n) {return ranges[rangesIndexes[n]];},
+      solution))
+  {
+    return solution;
+  } else {
+    return compute(tagPositions, ranges, rangesIndexes);
   }
 }
 
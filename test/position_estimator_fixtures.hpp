@@ -0,0 +1,68 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TEST__POSITION_ESTIMATOR_FIXTURES_HPP_
+#define TEST__POSITION_ESTIMATOR_FIXTURES_HPP_
+
+// Eigen
+#include <Eigen/Core>
+
+// std
+#include <optional>
+#include <vector>
+
+// romea
+#include "romea_core_common/containers/Eigen/VectorOfEigenVector.hpp"
+
+// Anchor layouts and tag positions shared by position estimator tests
+struct PositionEstimatorFixture
+{
+  romea::core::VectorOfEigenVector3d anchorPositions;
+  Eigen::Vector3d tagPosition;
+};
+
+//-----------------------------------------------------------------------------
+inline PositionEstimatorFixture makeTwoAnchorsFixture()
+{
+  return {{Eigen::Vector3d(0.0, 0.3, 1), Eigen::Vector3d(0.0, -0.3, 1)},
+    Eigen::Vector3d(5.0, 2.0, 2.0)};
+}
+
+//-----------------------------------------------------------------------------
+inline PositionEstimatorFixture makeThreeAnchorsUpFixture()
+{
+  return {{Eigen::Vector3d(0, 0.6, 2), Eigen::Vector3d(0, -0.6, 1.5), Eigen::Vector3d(1, 0, 1.8)},
+    Eigen::Vector3d(-4, 6, 1)};
+}
+
+//-----------------------------------------------------------------------------
+inline PositionEstimatorFixture makeThreeAnchorsDownFixture()
+{
+  return {{Eigen::Vector3d(0, 0.6, 2), Eigen::Vector3d(0, -0.6, 1.5), Eigen::Vector3d(-2, 0, 1.8)},
+    Eigen::Vector3d(-6, -7, 1)};
+}
+
+//-----------------------------------------------------------------------------
+inline std::vector<std::optional<double>> computeRanges(
+  const Eigen::Vector3d & tagPosition,
+  const romea::core::VectorOfEigenVector3d & anchorPositions)
+{
+  std::vector<std::optional<double>> ranges(anchorPositions.size());
+  for (size_t j = 0; j < anchorPositions.size(); ++j) {
+    ranges[j] = (tagPosition - anchorPositions[j]).head<2>().norm();
+  }
+  return ranges;
+}
+
+#endif  // TEST__POSITION_ESTIMATOR_FIXTURES_HPP_
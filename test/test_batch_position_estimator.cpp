@@ -0,0 +1,190 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <vector>
+
+// gtest
+#include "gtest/gtest.h"
+
+// romea
+#include "romea_core_rtls/trilateration/RTLSPosition2DEstimator.hpp"
+#include "romea_core_rtls/trilateration/RTLSBatchPosition2DEstimator.hpp"
+#include "position_estimator_fixtures.hpp"
+
+using RangeArray = romea::core::RTLSBatchPosition2DEstimator::RangeArray;
+
+RangeArray computeRangeArray(
+  const romea::core::VectorOfEigenVector3d & tagPositions,
+  const romea::core::VectorOfEigenVector3d & anchorPositions)
+{
+  RangeArray ranges(anchorPositions.size(), RangeArray::value_type(tagPositions.size()));
+  for (size_t k = 0; k < tagPositions.size(); ++k) {
+    auto tagRanges = computeRanges(tagPositions[k], anchorPositions);
+    for (size_t j = 0; j < anchorPositions.size(); ++j) {
+      ranges[j][k] = tagRanges[j];
+    }
+  }
+  return ranges;
+}
+
+void checkAgainstScalarEstimator(
+  const romea::core::VectorOfEigenVector3d & tagPositions,
+  const romea::core::VectorOfEigenVector3d & anchorPositions,
+  const RangeArray & ranges)
+{
+  romea::core::RTLSPosition2DEstimator estimator(anchorPositions, 0.001);
+  romea::core::RTLSBatchPosition2DEstimator batchEstimator(anchorPositions, 0.001);
+  EXPECT_TRUE(batchEstimator.init(ranges));
+  EXPECT_TRUE(batchEstimator.estimate(20, 0.02));
+  EXPECT_EQ(batchEstimator.getNumberOfTargetTags(), tagPositions.size());
+
+  for (size_t k = 0; k < tagPositions.size(); ++k) {
+    romea::core::RTLSPosition2DEstimator::RangeVector tagRanges(anchorPositions.size());
+    for (size_t j = 0; j < anchorPositions.size(); ++j) {
+      tagRanges[j] = ranges[j][k];
+    }
+
+    EXPECT_TRUE(estimator.init(tagRanges));
+    EXPECT_TRUE(estimator.estimate(20, 0.02));
+    EXPECT_TRUE(batchEstimator.isEstimated(k));
+
+    auto tagEstimatedPosition = batchEstimator.getEstimate(k);
+    EXPECT_NEAR(tagPositions[k].x(), tagEstimatedPosition.x(), 0.001);
+    EXPECT_NEAR(tagPositions[k].y(), tagEstimatedPosition.y(), 0.001);
+    EXPECT_NEAR(estimator.getEstimate()[0], tagEstimatedPosition.x(), 0.001);
+    EXPECT_NEAR(estimator.getEstimate()[1], tagEstimatedPosition.y(), 0.001);
+    EXPECT_TRUE(estimator.getEstimateCovariance().isApprox(
+        batchEstimator.getEstimateCovariance(k), 0.01));
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestRtlsBatchPositionEstimator, testBatchPositionEstimatorWithTwoAnchors)
+{
+  auto fixture = makeTwoAnchorsFixture();
+  romea::core::VectorOfEigenVector3d tagPositions = {
+    fixture.tagPosition,
+    Eigen::Vector3d(7.0, -3.0, 2.0)};
+
+  checkAgainstScalarEstimator(
+    tagPositions, fixture.anchorPositions,
+    computeRangeArray(tagPositions, fixture.anchorPositions));
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestRtlsBatchPositionEstimator, testBatchPositionEstimatorWithThreeAnchorsUp)
+{
+  auto fixture = makeThreeAnchorsUpFixture();
+  romea::core::VectorOfEigenVector3d tagPositions = {
+    fixture.tagPosition,
+    Eigen::Vector3d(-6, -7, 1),
+    Eigen::Vector3d(8, 3, 1)};
+
+  checkAgainstScalarEstimator(
+    tagPositions, fixture.anchorPositions,
+    computeRangeArray(tagPositions, fixture.anchorPositions));
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestRtlsBatchPositionEstimator, testBatchPositionEstimatorWithThreeAnchorsDown)
+{
+  auto fixture = makeThreeAnchorsDownFixture();
+  romea::core::VectorOfEigenVector3d tagPositions = {
+    fixture.tagPosition,
+    Eigen::Vector3d(-3, -9, 1),
+    Eigen::Vector3d(-8, 2, 1)};
+
+  checkAgainstScalarEstimator(
+    tagPositions, fixture.anchorPositions,
+    computeRangeArray(tagPositions, fixture.anchorPositions));
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestRtlsBatchPositionEstimator, testBatchPositionEstimatorWithManyTags)
+{
+  romea::core::VectorOfEigenVector3d anchorPositions = {
+    Eigen::Vector3d(-20, -20, 2),
+    Eigen::Vector3d(20, -20, 2),
+    Eigen::Vector3d(20, 20, 2),
+    Eigen::Vector3d(-20, 20, 2)};
+
+  romea::core::VectorOfEigenVector3d tagPositions;
+  for (double x = -15; x <= 15; x += 3) {
+    for (double y = -15; y <= 15; y += 5) {
+      tagPositions.emplace_back(x, y, 1);
+    }
+  }
+
+  checkAgainstScalarEstimator(
+    tagPositions, anchorPositions, computeRangeArray(tagPositions, anchorPositions));
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestRtlsBatchPositionEstimator, testBatchPositionEstimatorWithMissingRanges)
+{
+  romea::core::VectorOfEigenVector3d anchorPositions = {
+    Eigen::Vector3d(-20, -20, 2),
+    Eigen::Vector3d(20, -20, 2),
+    Eigen::Vector3d(20, 20, 2),
+    Eigen::Vector3d(-20, 20, 2)};
+
+  romea::core::VectorOfEigenVector3d tagPositions = {
+    Eigen::Vector3d(2, 3, 1),
+    Eigen::Vector3d(-5, 1, 1),
+    Eigen::Vector3d(4, -6, 1)};
+
+  auto ranges = computeRangeArray(tagPositions, anchorPositions);
+  ranges[3][0].reset();
+  ranges[1][1].reset();
+  ranges[2][1].reset();
+
+  romea::core::RTLSBatchPosition2DEstimator batchEstimator(anchorPositions, 0.001);
+  EXPECT_TRUE(batchEstimator.init(ranges));
+  EXPECT_TRUE(batchEstimator.estimate(20, 0.02));
+  EXPECT_TRUE(batchEstimator.isEstimated(0));
+  EXPECT_FALSE(batchEstimator.isEstimated(1));
+  EXPECT_TRUE(batchEstimator.isEstimated(2));
+  EXPECT_NEAR(tagPositions[0].x(), batchEstimator.getEstimate(0).x(), 0.001);
+  EXPECT_NEAR(tagPositions[0].y(), batchEstimator.getEstimate(0).y(), 0.001);
+  EXPECT_NEAR(tagPositions[2].x(), batchEstimator.getEstimate(2).x(), 0.001);
+  EXPECT_NEAR(tagPositions[2].y(), batchEstimator.getEstimate(2).y(), 0.001);
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestRtlsBatchPositionEstimator, testBatchPositionEstimatorWithDivergingTag)
+{
+  auto fixture = makeTwoAnchorsFixture();
+  auto ranges = computeRangeArray({fixture.tagPosition}, fixture.anchorPositions);
+
+  // range difference is greater than anchors baseline, Gauss-Newton iterations diverge
+  ranges[0].push_back(5.0);
+  ranges[1].push_back(4.0);
+
+  romea::core::RTLSBatchPosition2DEstimator batchEstimator(fixture.anchorPositions, 0.001);
+  EXPECT_TRUE(batchEstimator.init(ranges));
+  EXPECT_TRUE(batchEstimator.estimate(20, 0.02));
+  EXPECT_TRUE(batchEstimator.isEstimated(0));
+  EXPECT_FALSE(batchEstimator.isEstimated(1));
+  EXPECT_NEAR(fixture.tagPosition.x(), batchEstimator.getEstimate(0).x(), 0.001);
+  EXPECT_NEAR(fixture.tagPosition.y(), batchEstimator.getEstimate(0).y(), 0.001);
+  EXPECT_LT(batchEstimator.getEstimate(1).norm(), 10.0);
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,195 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+// gtest
+#include "gtest/gtest.h"
+
+// romea
+#include "romea_core_rtls/coordination/RTLSChannelArbiter.hpp"
+#include "romea_core_rtls/coordination/RTLSVirtualClock.hpp"
+
+//-----------------------------------------------------------------------------
+TEST(TestChannelArbiter, checkRobotsSharingRespondersGetDifferentSlots)
+{
+  std::vector<std::vector<size_t>> robotsReachableResponders = {
+    {0, 1}, {1, 2}, {3}, {2, 4}, {0, 2, 4}, {}};
+
+  auto slots = romea::core::RTLSChannelArbiter::assignSlots(robotsReachableResponders);
+  ASSERT_EQ(slots.size(), robotsReachableResponders.size());
+
+  for (size_t n = 0; n < robotsReachableResponders.size(); ++n) {
+    for (size_t m = n + 1; m < robotsReachableResponders.size(); ++m) {
+      bool isConflicting = false;
+      for (const size_t & responderIndex : robotsReachableResponders[n]) {
+        const auto & responders = robotsReachableResponders[m];
+        isConflicting |=
+          std::find(responders.begin(), responders.end(), responderIndex) != responders.end();
+      }
+      if (isConflicting) {
+        EXPECT_NE(slots[n], slots[m]);
+      }
+    }
+  }
+
+  EXPECT_EQ(*std::max_element(slots.begin(), slots.end()), 2);
+  EXPECT_EQ(slots[2], 0);
+  EXPECT_EQ(slots[5], 0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestChannelArbiter, checkRequestsAreForwardedDuringRobotSlot)
+{
+  auto clock = std::make_shared<romea::core::RTLSVirtualClock>();
+  romea::core::RTLSChannelArbiter arbiter(romea::core::durationFromMilliSecond(10), clock);
+
+  std::vector<size_t> dispatchedRobots;
+  std::vector<romea::core::Duration> dispatchedTimeouts;
+  std::vector<romea::core::RTLSChannelArbiter::RangingRequestCallback> callbacks(3);
+  for (size_t robotIndex = 0; robotIndex < 3; ++robotIndex) {
+    arbiter.addRobot([&, robotIndex](
+        const size_t & initiatorIndex,
+        const size_t & responderIndex,
+        const romea::core::Duration & timeout)
+      {
+        dispatchedRobots.push_back(robotIndex);
+        dispatchedTimeouts.push_back(timeout);
+        callbacks[robotIndex](initiatorIndex, responderIndex, timeout);
+      });
+    callbacks[robotIndex] = arbiter.getRangingRequestCallback(robotIndex);
+  }
+
+  arbiter.updateRobotReachableResponders(0, {0, 1});
+  arbiter.updateRobotReachableResponders(1, {1, 2});
+  arbiter.updateRobotReachableResponders(2, {5});
+  EXPECT_EQ(arbiter.getNumberOfSlots(), 2);
+  EXPECT_NE(arbiter.getRobotSlot(0), arbiter.getRobotSlot(1));
+
+  for (size_t robotIndex = 0; robotIndex < 3; ++robotIndex) {
+    callbacks[robotIndex](0, 1, romea::core::durationFromSecond(1));
+  }
+
+  arbiter.start();
+  clock->advance(romea::core::durationFromMilliSecond(200));
+  arbiter.stop();
+
+  size_t numberOfConflictingDispatches = 0;
+  for (size_t n = 1; n < dispatchedRobots.size(); ++n) {
+    numberOfConflictingDispatches += dispatchedRobots[n] < 2 &&
+      dispatchedRobots[n] == dispatchedRobots[n - 1];
+  }
+
+  EXPECT_GE(dispatchedRobots.size(), 20);
+  EXPECT_EQ(numberOfConflictingDispatches, 0);
+  EXPECT_NEAR(
+    std::count(dispatchedRobots.begin(), dispatchedRobots.end(), 0),
+    std::count(dispatchedRobots.begin(), dispatchedRobots.end(), 1), 1);
+  for (const auto & timeout : dispatchedTimeouts) {
+    EXPECT_EQ(timeout, romea::core::durationFromMilliSecond(10));
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestChannelArbiter, checkReplacedRequestsAreReportedAsDropped)
+{
+  auto clock = std::make_shared<romea::core::RTLSVirtualClock>();
+  romea::core::RTLSChannelArbiter arbiter(romea::core::durationFromMilliSecond(10), clock);
+
+  std::vector<std::pair<size_t, size_t>> droppedRequests;
+  std::vector<romea::core::Duration> dispatchedTimeouts;
+  arbiter.addRobot(
+    [](const size_t &, const size_t &, const romea::core::Duration &) {},
+    [&](const size_t &, const size_t &, const romea::core::Duration & timeout)
+    {
+      dispatchedTimeouts.push_back(timeout);
+    },
+    [&](const size_t & initiatorIndex, const size_t & responderIndex)
+    {
+      droppedRequests.emplace_back(initiatorIndex, responderIndex);
+    });
+
+  auto callback = arbiter.getRangingRequestCallback(0);
+  callback(0, 1, romea::core::durationFromSecond(1));
+  callback(0, 2, romea::core::durationFromSecond(1));
+  callback(0, 3, romea::core::durationFromMilliSecond(5));
+
+  EXPECT_EQ(arbiter.getNumberOfDroppedRequests(0), 2);
+  ASSERT_EQ(droppedRequests.size(), 2);
+  EXPECT_EQ(droppedRequests[0], std::make_pair(size_t(0), size_t(1)));
+  EXPECT_EQ(droppedRequests[1], std::make_pair(size_t(0), size_t(2)));
+
+  arbiter.start();
+  clock->advance(romea::core::durationFromMilliSecond(50));
+  arbiter.stop();
+
+  ASSERT_EQ(dispatchedTimeouts.size(), 1);
+  EXPECT_EQ(dispatchedTimeouts[0], romea::core::durationFromMilliSecond(5));
+  EXPECT_EQ(arbiter.getNumberOfDroppedRequests(0), 2);
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestChannelArbiter, checkLatenciesAreMeasuredFromDispatch)
+{
+  auto clock = std::make_shared<romea::core::RTLSVirtualClock>();
+  romea::core::RTLSChannelArbiter arbiter(romea::core::durationFromMilliSecond(10), clock);
+
+  // responders answer as soon as requests are dispatched but waiting for the slot
+  // of the other robot sharing responder0 delays them by up to 20ms
+  std::unique_ptr<romea::core::RTLSSimpleCoordinatorScheduler> scheduler;
+  romea::core::RTLSTransceiverRangingResult result;
+  result.range = 1.0;
+
+  arbiter.addRobot(
+    [&](const size_t & initiatorIndex, const size_t & responderIndex,
+    const romea::core::Duration &)
+    {
+      scheduler->feedback(initiatorIndex, responderIndex, result);
+    },
+    [&](const size_t & initiatorIndex, const size_t & responderIndex,
+    const romea::core::Duration & timeout)
+    {
+      scheduler->dispatch(initiatorIndex, responderIndex, timeout);
+    });
+  arbiter.addRobot([](const size_t &, const size_t &, const romea::core::Duration &) {});
+  arbiter.updateRobotReachableResponders(0, {0});
+  arbiter.updateRobotReachableResponders(1, {0});
+
+  scheduler = std::make_unique<romea::core::RTLSSimpleCoordinatorScheduler>(
+    15.0, std::vector<std::string>{"initiator0"}, std::vector<std::string>{"responder0"},
+    arbiter.getRangingRequestCallback(0),
+    romea::core::RTLSSimpleCoordinatorScheduler::PollingMode::TIMER, clock);
+  scheduler->enableAdaptiveTimeouts(0.95, 1.5, romea::core::durationFromMilliSecond(2));
+
+  arbiter.start();
+  scheduler->start();
+  clock->advance(romea::core::durationFromSecond(2));
+  scheduler->stop();
+  arbiter.stop();
+
+  EXPECT_EQ(arbiter.getNumberOfDroppedRequests(0), 0);
+  EXPECT_EQ(scheduler->getTimeout(0, 0), romea::core::durationFromMilliSecond(2));
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,151 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Eigen
+#define EIGEN_RUNTIME_NO_MALLOC
+#include <Eigen/Core>
+
+// std
+#include <vector>
+
+// gtest
+#include "gtest/gtest.h"
+
+// romea
+#include "romea_core_common/math/EulerAngles.hpp"
+#include "romea_core_rtls/trilateration/RTLSPosition2DEstimator.hpp"
+#include "romea_core_rtls/trilateration/RTLSPose2DEstimator.hpp"
+#include "romea_core_rtls/trilateration/RTLSFixedSizePosition2DEstimator.hpp"
+#include "romea_core_rtls/trilateration/RTLSFixedSizePose2DEstimator.hpp"
+
+//-----------------------------------------------------------------------------
+TEST(TestRtlsFixedSizeEstimators, testPositionEstimatorWithTwoAnchors)
+{
+  auto tag0Position = Eigen::Vector3d(5.0, 2.0, 2.0);
+  auto anchor0Position = Eigen::Vector3d(0.0, 0.3, 1);
+  auto anchor1Position = Eigen::Vector3d(0.0, -0.3, 1);
+  double r00 = (tag0Position - anchor0Position).head<2>().norm();
+  double r01 = (tag0Position - anchor1Position).head<2>().norm();
+
+  romea::core::RTLSFixedSizePosition2DEstimator<4> estimator(
+    {anchor0Position, anchor1Position}, 0.001);
+  romea::core::RTLSFixedSizePosition2DEstimator<4>::RangeVector ranges = {r00, r01};
+
+  Eigen::internal::set_is_malloc_allowed(false);
+  EXPECT_TRUE(estimator.init(ranges));
+  EXPECT_TRUE(estimator.estimate(20, 0.02));
+  Eigen::internal::set_is_malloc_allowed(true);
+
+  auto tag0EstimatedPosition = estimator.getEstimate();
+  EXPECT_NEAR(tag0Position.x(), tag0EstimatedPosition.x(), 0.001);
+  EXPECT_NEAR(tag0Position.y(), tag0EstimatedPosition.y(), 0.001);
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestRtlsFixedSizeEstimators, testPositionEstimatorAgainstDynamicEstimator)
+{
+  romea::core::VectorOfEigenVector3d anchorPositions = {
+    Eigen::Vector3d(0, 0.6, 2),
+    Eigen::Vector3d(0, -0.6, 1.5),
+    Eigen::Vector3d(1, 0, 1.8)};
+
+  romea::core::RTLSPosition2DEstimator estimator(anchorPositions, 0.001);
+  romea::core::RTLSFixedSizePosition2DEstimator<8> fixedSizeEstimator(anchorPositions, 0.001);
+
+  for (const auto & tagPosition : {Eigen::Vector3d(-4, 6, 1), Eigen::Vector3d(-6, -7, 1)}) {
+    romea::core::RTLSPosition2DEstimator::RangeVector ranges;
+    for (const auto & anchorPosition : anchorPositions) {
+      ranges.push_back((tagPosition - anchorPosition).head<2>().norm());
+    }
+
+    EXPECT_TRUE(estimator.init(ranges));
+    EXPECT_TRUE(estimator.estimate(20, 0.02));
+
+    Eigen::internal::set_is_malloc_allowed(false);
+    EXPECT_TRUE(fixedSizeEstimator.init(ranges));
+    EXPECT_TRUE(fixedSizeEstimator.estimate(20, 0.02));
+    Eigen::internal::set_is_malloc_allowed(true);
+
+    EXPECT_NEAR(tagPosition.x(), fixedSizeEstimator.getEstimate().x(), 0.001);
+    EXPECT_NEAR(tagPosition.y(), fixedSizeEstimator.getEstimate().y(), 0.001);
+    EXPECT_TRUE(estimator.getEstimateCovariance().isApprox(
+        fixedSizeEstimator.getEstimateCovariance(), 0.01));
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestRtlsFixedSizeEstimators, testPoseEstimator)
+{
+  using RangeVector = std::vector<std::optional<double>>;
+  using RangeArray = std::vector<RangeVector>;
+
+  romea::core::VectorOfEigenVector3d tagPositions;
+  tagPositions.emplace_back(0, -0.3, 1.01);
+  tagPositions.emplace_back(0, 0.3, 1.01);
+  tagPositions.emplace_back(0.44, 0, 0.71);
+
+  romea::core::VectorOfEigenVector3d anchorPositions;
+  anchorPositions.emplace_back(0, -0.21, 0.39);
+  anchorPositions.emplace_back(0, 0.21, 0.39);
+  anchorPositions.emplace_back(0.85, 0, 0.44);
+
+  romea::core::RTLSPose2DEstimator estimator(anchorPositions, tagPositions, 0.001);
+  romea::core::RTLSFixedSizePose2DEstimator<4, 4> fixedSizeEstimator(
+    anchorPositions, tagPositions, 0.001);
+
+  double rho = 5;
+  double theta = 0;
+  double course = -M_PI;
+  for (; theta < 2 * M_PI; theta += M_PI / 4, course += M_PI / 3) {
+    Eigen::Matrix3d R = romea::core::eulerAnglesToRotation3D(
+      Eigen::Vector3d(0, 0, romea::core::between0And2Pi(course)));
+    Eigen::Vector3d T(rho * std::cos(theta), rho * std::cos(theta), 0);
+
+    RangeArray ranges(3, RangeVector(3));
+    for (size_t i = 0; i < 3; i++) {
+      for (size_t j = 0; j < 3; j++) {
+        ranges[i][j] = ((R * anchorPositions[i] + T) - tagPositions[j]).head<2>().norm();
+      }
+    }
+
+    EXPECT_TRUE(estimator.init(ranges));
+    EXPECT_TRUE(estimator.estimate(10, 0.02));
+
+    Eigen::internal::set_is_malloc_allowed(false);
+    EXPECT_TRUE(fixedSizeEstimator.init(ranges));
+    EXPECT_TRUE(fixedSizeEstimator.estimate(10, 0.02));
+    Eigen::internal::set_is_malloc_allowed(true);
+
+    EXPECT_NEAR(T[0], fixedSizeEstimator.getEstimate()[0], 0.01);
+    EXPECT_NEAR(T[1], fixedSizeEstimator.getEstimate()[1], 0.01);
+    EXPECT_NEAR(
+      romea::core::betweenMinusPiAndPi(course - fixedSizeEstimator.getEstimate()[2]), 0.0, 0.01);
+    EXPECT_TRUE(estimator.getEstimateCovariance().isApprox(
+        fixedSizeEstimator.getEstimateCovariance(), 0.01));
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestRtlsFixedSizeEstimators, testTooManyReferenceTags)
+{
+  romea::core::VectorOfEigenVector3d anchorPositions(3, Eigen::Vector3d::Zero());
+  EXPECT_ANY_THROW(romea::core::RTLSFixedSizePosition2DEstimator<2> estimator(anchorPositions));
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
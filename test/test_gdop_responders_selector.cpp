@@ -0,0 +1,117 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+// gtest
+#include "gtest/gtest.h"
+
+// romea
+#include "romea_core_rtls/coordination/RTLSGDOPRespondersSelector.hpp"
+
+namespace
+{
+
+romea::core::VectorOfEigenVector3d makeRespondersPositions()
+{
+  // a ring of anchors completed by a cluster of nearly aligned ones
+  romea::core::VectorOfEigenVector3d respondersPositions;
+  for (size_t n = 0; n < 8; ++n) {
+    double angle = 2 * M_PI * n / 8;
+    respondersPositions.emplace_back(20 * std::cos(angle), 20 * std::sin(angle), 2.0);
+  }
+  for (size_t n = 0; n < 8; ++n) {
+    respondersPositions.emplace_back(30.0 + n, 1.0, 2.0);
+  }
+  return respondersPositions;
+}
+
+double bestGDOP(
+  const romea::core::RTLSGDOPRespondersSelector & selector,
+  const Eigen::Vector3d & position,
+  const std::vector<size_t> & candidates,
+  const size_t & numberOfSelectedResponders)
+{
+  std::vector<bool> mask(candidates.size(), false);
+  std::fill(mask.begin(), mask.begin() + numberOfSelectedResponders, true);
+
+  double gdop = std::numeric_limits<double>::infinity();
+  do {
+    std::vector<size_t> subset;
+    for (size_t n = 0; n < candidates.size(); ++n) {
+      if (mask[n]) {
+        subset.push_back(candidates[n]);
+      }
+    }
+    gdop = std::min(gdop, selector.computeGDOP(position, subset));
+  } while (std::prev_permutation(mask.begin(), mask.end()));
+
+  return gdop;
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+TEST(TestGDOPRespondersSelector, checkSelectionIsCloseToOptimal)
+{
+  auto respondersPositions = makeRespondersPositions();
+  romea::core::RTLSGDOPRespondersSelector selector(respondersPositions);
+
+  std::vector<size_t> candidates(respondersPositions.size());
+  std::iota(candidates.begin(), candidates.end(), 0);
+
+  Eigen::Vector3d position(5.0, -3.0, 0.0);
+  for (size_t k = 2; k <= 5; ++k) {
+    const auto & selected = selector.select(position, candidates, k);
+    ASSERT_EQ(selected.size(), k);
+    EXPECT_TRUE(std::is_sorted(selected.begin(), selected.end()));
+    EXPECT_LE(
+      selector.computeGDOP(position, selected),
+      1.05 * bestGDOP(selector, position, candidates, k));
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestGDOPRespondersSelector, checkAlignedRespondersAreAvoided)
+{
+  auto respondersPositions = makeRespondersPositions();
+  romea::core::RTLSGDOPRespondersSelector selector(respondersPositions);
+
+  std::vector<size_t> candidates = {0, 8, 9, 10, 11, 12, 13, 14, 15, 2};
+  const auto & selected = selector.select(Eigen::Vector3d::Zero(), candidates, 2);
+  ASSERT_EQ(selected.size(), 2);
+  EXPECT_EQ(selected[0], 2);
+  EXPECT_LT(selector.computeGDOP(Eigen::Vector3d::Zero(), selected), 1.5);
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestGDOPRespondersSelector, checkSelectionWhenThereAreNotEnoughCandidates)
+{
+  romea::core::RTLSGDOPRespondersSelector selector(makeRespondersPositions());
+
+  std::vector<size_t> candidates = {3, 7};
+  EXPECT_EQ(selector.select(Eigen::Vector3d::Zero(), candidates, 4), candidates);
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 // std
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
@@ -23,12 +24,14 @@
 
 // romea
 #include "romea_core_rtls/coordination/RTLSGeoreferencedCoordinatorScheduler.hpp"
+#include "romea_core_rtls/coordination/RTLSVirtualClock.hpp"
 
 class TestGeoreferencedCoordinatorScheduler : public ::testing::Test
 {
 protected:
   TestGeoreferencedCoordinatorScheduler()
-  : scheduler_(nullptr),
+  : clock_(std::make_shared<romea::core::RTLSVirtualClock>()),
+    scheduler_(nullptr),
     initiatorsIndexes_(),
     respondersIndexes_()
   {
@@ -66,9 +69,12 @@ protected:
       pollRate, maximalResearchDistance,
       initiatorsNames, initiatorsPositions,
       respondersNames, respondersPositions,
-      callback);
+      callback,
+      romea::core::RTLSGeoreferencedCoordinatorScheduler::PollingMode::TIMER,
+      clock_);
   }
 
+  std::shared_ptr<romea::core::RTLSVirtualClock> clock_;
   std::unique_ptr<romea::core::RTLSGeoreferencedCoordinatorScheduler> scheduler_;
   std::vector<size_t> initiatorsIndexes_;
   std::vector<size_t> respondersIndexes_;
@@ -80,7 +86,7 @@ TEST_F(TestGeoreferencedCoordinatorScheduler, checkPollWhenNoPositionIsGiven)
   init(30, 20);
 
   scheduler_->start();
-  std::this_thread::sleep_for(romea::core::durationFromSecond(2));
+  clock_->advance(romea::core::durationFromSecond(2));
   scheduler_->stop();
 
   EXPECT_EQ(initiatorsIndexes_[6], 0);
@@ -105,9 +111,9 @@ TEST_F(TestGeoreferencedCoordinatorScheduler, checkPollWhenAllRespondersAreVisib
 {
   init(30, 20);
   scheduler_->start();
-  std::this_thread::sleep_for(romea::core::durationFromMilliSecond(100));
+  clock_->advance(romea::core::durationFromMilliSecond(100));
   scheduler_->updateRobotPosition(Eigen::Vector3d::Zero());
-  std::this_thread::sleep_for(romea::core::durationFromMilliSecond(1900));
+  clock_->advance(romea::core::durationFromMilliSecond(1900));
   scheduler_->stop();
 
   EXPECT_EQ(initiatorsIndexes_[6], 0);
@@ -132,9 +138,9 @@ TEST_F(TestGeoreferencedCoordinatorScheduler, checkPollWhenTwoRespondersAreVisib
 {
   init(30, 20);
   scheduler_->start();
-  std::this_thread::sleep_for(romea::core::durationFromMilliSecond(100));
+  clock_->advance(romea::core::durationFromMilliSecond(100));
   scheduler_->updateRobotPosition(Eigen::Vector3d(13, 0, 0));
-  std::this_thread::sleep_for(romea::core::durationFromMilliSecond(1900));
+  clock_->advance(romea::core::durationFromMilliSecond(1900));
   scheduler_->stop();
 
 
@@ -172,9 +178,9 @@ TEST_F(TestGeoreferencedCoordinatorScheduler, checkPollWhenOnlyOneResponderIsVis
 {
   init(30, 20);
   scheduler_->start();
-  std::this_thread::sleep_for(romea::core::durationFromMilliSecond(100));
+  clock_->advance(romea::core::durationFromMilliSecond(100));
   scheduler_->updateRobotPosition(Eigen::Vector3d(23, 0, 0));
-  std::this_thread::sleep_for(romea::core::durationFromMilliSecond(1900));
+  clock_->advance(romea::core::durationFromMilliSecond(1900));
   scheduler_->stop();
 
 
@@ -198,6 +204,121 @@ TEST_F(TestGeoreferencedCoordinatorScheduler, checkPollWhenOnlyOneResponderIsVis
 }
 
 
+TEST_F(TestGeoreferencedCoordinatorScheduler, checkPollWhenRespondersAreSelectedByGDOP)
+{
+  init(30, 20);
+  scheduler_->setMaximalNumberOfSelectedResponders(2);
+  scheduler_->start();
+  scheduler_->updateRobotPosition(Eigen::Vector3d(-2, 5, 0));
+  clock_->advance(romea::core::durationFromMilliSecond(500));
+  scheduler_->stop();
+
+  auto selectedRespondersIndexes = scheduler_->getSelectedRespondersIndexes();
+  ASSERT_EQ(selectedRespondersIndexes.size(), 2);
+  EXPECT_EQ(selectedRespondersIndexes[0], 0);
+  EXPECT_EQ(selectedRespondersIndexes[1], 1);
+}
+
+TEST_F(TestGeoreferencedCoordinatorScheduler, checkPollWhenRespondersAreAddedAndRemoved)
+{
+  init(30, 20);
+  scheduler_->start();
+  scheduler_->updateRobotPosition(Eigen::Vector3d(13, 0, 0));
+  clock_->advance(romea::core::durationFromMilliSecond(200));
+  EXPECT_EQ(scheduler_->getSelectedRespondersIndexes(), std::vector<size_t>({1, 2}));
+
+  EXPECT_EQ(scheduler_->addResponder("responder3", Eigen::Vector3d(20, 5, 2)), 3);
+  scheduler_->removeResponder(1);
+  scheduler_->updateRobotPosition(Eigen::Vector3d(13, 0, 0));
+  clock_->advance(romea::core::durationFromMilliSecond(200));
+  EXPECT_EQ(scheduler_->getSelectedRespondersIndexes(), std::vector<size_t>({2, 3}));
+
+  scheduler_->updateResponderPosition(3, Eigen::Vector3d(50, 5, 2));
+  scheduler_->updateRobotPosition(Eigen::Vector3d(13, 0, 0));
+  clock_->advance(romea::core::durationFromMilliSecond(200));
+  scheduler_->stop();
+  EXPECT_EQ(scheduler_->getSelectedRespondersIndexes(), std::vector<size_t>({2}));
+}
+
+TEST_F(TestGeoreferencedCoordinatorScheduler, checkPollWhenWeightedSuperframeIsUsed)
+{
+  init(30, 20);
+  scheduler_->setNearRespondersPollWeight(5, 2);
+  scheduler_->enableSuperframe();
+  scheduler_->start();
+  scheduler_->updateRobotPosition(Eigen::Vector3d(13, 0, 0));
+  clock_->advance(romea::core::durationFromMilliSecond(500));
+  scheduler_->stop();
+
+  const auto & superframe = scheduler_->getSuperframe();
+  ASSERT_EQ(superframe.size(), 6);
+  EXPECT_EQ(superframe[0].responderIndex, 2);
+  EXPECT_EQ(superframe[1].responderIndex, 1);
+  EXPECT_EQ(superframe[2].responderIndex, 2);
+  EXPECT_EQ(superframe[3].initiatorIndex, 1);
+  EXPECT_EQ(superframe[3].responderIndex, 2);
+  EXPECT_EQ(superframe[5].responderIndex, 2);
+
+  EXPECT_EQ(std::count(respondersIndexes_.begin() + 6, respondersIndexes_.end(), 0), 0);
+  EXPECT_GT(
+    std::count(respondersIndexes_.begin() + 6, respondersIndexes_.end(), 2),
+    std::count(respondersIndexes_.begin() + 6, respondersIndexes_.end(), 1));
+}
+
+TEST_F(TestGeoreferencedCoordinatorScheduler, checkPollWhenInformationGainIsUsed)
+{
+  init(30, 20);
+  Eigen::Matrix2d covariance = Eigen::Vector2d(0.0001, 4.0).asDiagonal();
+  scheduler_->enableInformationGainPolling(
+    [covariance]() {return covariance;}, 0.1, romea::core::durationFromSecond(10));
+  scheduler_->updateRobotPosition(Eigen::Vector3d(0, 5, 0));
+  scheduler_->start();
+  clock_->advance(romea::core::durationFromMilliSecond(1000));
+  scheduler_->stop();
+
+  // each link is polled once first since none of them has ever been polled
+  ASSERT_GT(respondersIndexes_.size(), 20u);
+  EXPECT_EQ(std::count(respondersIndexes_.begin(), respondersIndexes_.begin() + 6, 1), 2);
+  EXPECT_GT(
+    std::count(respondersIndexes_.begin() + 6, respondersIndexes_.end(), 1),
+    0.8 * (respondersIndexes_.size() - 6));
+  EXPECT_GT(std::count(initiatorsIndexes_.begin() + 6, initiatorsIndexes_.end(), 0), 5);
+  EXPECT_GT(std::count(initiatorsIndexes_.begin() + 6, initiatorsIndexes_.end(), 1), 5);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(TestGeoreferencedCoordinatorScheduler, checkPrunedLinksAreNotPolledForInformationGain)
+{
+  init(30, 20);
+  Eigen::Matrix2d covariance = Eigen::Vector2d(0.0001, 4.0).asDiagonal();
+  scheduler_->enableInformationGainPolling(
+    [covariance]() {return covariance;}, 0.1, romea::core::durationFromSecond(10));
+  scheduler_->enableLinksPruning(
+    0.3, romea::core::durationFromSecond(10), romea::core::durationFromSecond(10));
+
+  // link between initiator0 and responder1 is blocked
+  for (size_t n = 0; n < 20; ++n) {
+    scheduler_->feedback(0, 1, romea::core::RTLSTransceiverRangingResult());
+  }
+  ASSERT_TRUE(scheduler_->isLinkPruned(0, 1));
+
+  scheduler_->updateRobotPosition(Eigen::Vector3d(0, 5, 0));
+  scheduler_->start();
+  clock_->advance(romea::core::durationFromMilliSecond(1000));
+  scheduler_->stop();
+
+  size_t numberOfPrunedLinkPolls = 0;
+  for (size_t n = 0; n < respondersIndexes_.size(); ++n) {
+    numberOfPrunedLinkPolls += initiatorsIndexes_[n] == 0 && respondersIndexes_[n] == 1;
+  }
+
+  ASSERT_GT(respondersIndexes_.size(), 20u);
+  EXPECT_EQ(numberOfPrunedLinkPolls, 0u);
+  EXPECT_GT(
+    std::count(respondersIndexes_.begin(), respondersIndexes_.end(), 1),
+    0.5 * respondersIndexes_.size());
+}
+
 //-----------------------------------------------------------------------------
 int main(int argc, char ** argv)
 {
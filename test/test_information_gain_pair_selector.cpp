@@ -0,0 +1,168 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <vector>
+
+// gtest
+#include "gtest/gtest.h"
+
+// romea
+#include "romea_core_rtls/coordination/RTLSInformationGainPairSelector.hpp"
+
+class TestInformationGainPairSelector : public ::testing::Test
+{
+public:
+  TestInformationGainPairSelector()
+  : respondersPositions_({
+      Eigen::Vector3d(10.0, 0.0, 0.0),
+      Eigen::Vector3d(0.0, 10.0, 0.0),
+      Eigen::Vector3d(-10.0, 0.0, 0.0)}),
+    stamp_(romea::core::durationFromSecond(10)),
+    initiatorIndex_(0),
+    responderIndex_(0)
+  {
+  }
+
+  bool select(
+    romea::core::RTLSInformationGainPairSelector & selector,
+    const std::vector<size_t> & candidatesIndexes = {0, 1, 2})
+  {
+    stamp_ += romea::core::durationFromMilliSecond(100);
+    return selector.select(
+      Eigen::Vector3d::Zero(), candidatesIndexes, stamp_, initiatorIndex_, responderIndex_);
+  }
+
+  romea::core::VectorOfEigenVector3d respondersPositions_;
+  romea::core::TimePoint stamp_;
+  size_t initiatorIndex_;
+  size_t responderIndex_;
+};
+
+//-----------------------------------------------------------------------------
+TEST_F(TestInformationGainPairSelector, checkTraceReduction)
+{
+  romea::core::RTLSInformationGainPairSelector selector(
+    1, respondersPositions_, 0.1, romea::core::durationFromSecond(100));
+  selector.setCovariance(Eigen::Vector2d(4.0, 1.0).asDiagonal());
+
+  EXPECT_NEAR(selector.computeTraceReduction(Eigen::Vector3d::Zero(), 0), 16 / 4.01, 1e-9);
+  EXPECT_NEAR(selector.computeTraceReduction(Eigen::Vector3d::Zero(), 1), 1 / 1.01, 1e-9);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(TestInformationGainPairSelector, checkMostUncertainAxisIsPolled)
+{
+  romea::core::RTLSInformationGainPairSelector selector(
+    1, respondersPositions_, 0.1, romea::core::durationFromSecond(100));
+  selector.setCovariance(Eigen::Vector2d(0.0001, 4.0).asDiagonal());
+
+  // links which have never been polled come first
+  for (size_t n = 0; n < 3; ++n) {
+    ASSERT_TRUE(select(selector));
+    EXPECT_EQ(responderIndex_, n);
+  }
+
+  ASSERT_TRUE(select(selector));
+  EXPECT_EQ(responderIndex_, 1u);
+  EXPECT_LT(selector.getCovariance()(1, 1), 0.01);
+  EXPECT_FALSE(select(selector, {}));
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(TestInformationGainPairSelector, checkExpectedCovarianceIsUsedUntilSourceChanges)
+{
+  romea::core::RTLSInformationGainPairSelector selector(
+    1, respondersPositions_, 0.1, romea::core::durationFromSecond(100));
+  Eigen::Matrix2d covariance = Eigen::Matrix2d::Identity();
+
+  selector.setCovariance(covariance);
+  ASSERT_TRUE(select(selector, {0, 1}));
+  size_t firstResponderIndex = responderIndex_;
+
+  selector.setCovariance(covariance);
+  ASSERT_TRUE(select(selector, {0, 1}));
+  EXPECT_NE(responderIndex_, firstResponderIndex);
+
+  selector.setCovariance(2 * covariance);
+  EXPECT_EQ(selector.getCovariance(), 2 * covariance);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(TestInformationGainPairSelector, checkLinksDoNotStarve)
+{
+  romea::core::RTLSInformationGainPairSelector selector(
+    2, respondersPositions_, 0.1, romea::core::durationFromSecond(1));
+
+  std::vector<size_t> counts(6, 0);
+  for (size_t n = 0; n < 100; ++n) {
+    selector.setCovariance(Eigen::Vector2d(0.0001 * (n + 1), 4.0).asDiagonal());
+    ASSERT_TRUE(select(selector));
+    ++counts[responderIndex_ * 2 + initiatorIndex_];
+  }
+
+  // 10 seconds, each link must be polled at least once per second
+  for (size_t n = 0; n < 6; ++n) {
+    EXPECT_GE(counts[n], 9u);
+  }
+  EXPECT_GT(counts[2] + counts[3], 50u);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(TestInformationGainPairSelector, checkInitiatorsAreUsedInTurn)
+{
+  romea::core::RTLSInformationGainPairSelector selector(
+    2, respondersPositions_, 0.1, romea::core::durationFromSecond(100));
+
+  std::vector<size_t> initiatorsIndexes;
+  for (size_t n = 0; n < 6; ++n) {
+    selector.setCovariance(Eigen::Vector2d(0.0001 * (n + 1), 4.0).asDiagonal());
+    ASSERT_TRUE(select(selector, {1}));
+    initiatorsIndexes.push_back(initiatorIndex_);
+  }
+  EXPECT_EQ(initiatorsIndexes, std::vector<size_t>({0, 1, 0, 1, 0, 1}));
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(TestInformationGainPairSelector, checkFilteredLinksAreNotSelected)
+{
+  romea::core::RTLSInformationGainPairSelector selector(
+    2, respondersPositions_, 0.1, romea::core::durationFromSecond(1));
+
+  // link between initiator1 and responder1 is rejected, responder2 is fully rejected
+  auto isLinkSelectable = [](const size_t & initiatorIndex, const size_t & responderIndex) {
+      return responderIndex != 2 && !(initiatorIndex == 1 && responderIndex == 1);
+    };
+
+  for (size_t n = 0; n < 100; ++n) {
+    stamp_ += romea::core::durationFromMilliSecond(100);
+    selector.setCovariance(Eigen::Vector2d(0.0001 * (n + 1), 4.0).asDiagonal());
+    ASSERT_TRUE(
+      selector.select(
+        Eigen::Vector3d::Zero(), {0, 1, 2}, stamp_,
+        initiatorIndex_, responderIndex_, isLinkSelectable));
+    EXPECT_TRUE(isLinkSelectable(initiatorIndex_, responderIndex_));
+  }
+
+  EXPECT_FALSE(
+    selector.select(
+      Eigen::Vector3d::Zero(), {2}, stamp_, initiatorIndex_, responderIndex_, isLinkSelectable));
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
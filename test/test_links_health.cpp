@@ -0,0 +1,74 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// gtest
+#include "gtest/gtest.h"
+
+// romea
+#include "romea_core_rtls/coordination/RTLSLinksHealth.hpp"
+
+// backoff itself is checked by probing backoff tests
+
+//-----------------------------------------------------------------------------
+TEST(TestLinksHealth, checkOnlyLowQualityFailingLinkIsPruned)
+{
+  romea::core::TimePoint stamp(romea::core::durationFromSecond(10));
+  romea::core::RTLSLinksHealth health(
+    2, 2, 0.3,
+    romea::core::durationFromMilliSecond(100), romea::core::durationFromMilliSecond(400));
+
+  for (size_t n = 0; n < 3; ++n) {
+    health.feedback(0, 1, stamp, false, 0.5);
+    health.feedback(1, 0, stamp, false, 0.2);
+  }
+
+  EXPECT_FALSE(health.isPruned(0, 1));
+  EXPECT_TRUE(health.isPruned(1, 0));
+  EXPECT_EQ(health.getNumberOfPrunedLinks(), 1u);
+
+  EXPECT_FALSE(health.canPoll(1, 0, stamp));
+  EXPECT_TRUE(health.canPoll(0, 0, stamp));
+  EXPECT_TRUE(health.canPoll(1, 1, stamp));
+  EXPECT_TRUE(health.canPoll(0, 1, stamp));
+
+  stamp += romea::core::durationFromMilliSecond(100);
+  EXPECT_TRUE(health.canPoll(1, 0, stamp));
+  health.commitProbe(1, 0, stamp);
+  EXPECT_FALSE(health.canPoll(1, 0, stamp));
+  EXPECT_EQ(health.getNumberOfProbes(), 1u);
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestLinksHealth, checkAddResponder)
+{
+  romea::core::TimePoint stamp(romea::core::durationFromSecond(10));
+  romea::core::RTLSLinksHealth health(
+    2, 2, 0.3,
+    romea::core::durationFromMilliSecond(100), romea::core::durationFromMilliSecond(400));
+
+  health.addResponder();
+  for (size_t n = 0; n < 3; ++n) {
+    health.feedback(1, 2, stamp, false, 0.);
+  }
+  EXPECT_TRUE(health.isPruned(1, 2));
+  EXPECT_FALSE(health.isPruned(0, 2));
+  EXPECT_FALSE(health.isPruned(1, 1));
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
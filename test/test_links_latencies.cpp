@@ -0,0 +1,118 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <random>
+
+// gtest
+#include "gtest/gtest.h"
+
+// romea
+#include "romea_core_rtls/coordination/RTLSLinksLatencies.hpp"
+
+//-----------------------------------------------------------------------------
+TEST(TestLinksLatencies, checkQuantileConvergence)
+{
+  romea::core::RTLSLinksLatencies linksLatencies(
+    2, 2, 0.95, 1.0, romea::core::durationFromMilliSecond(1));
+
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<double> shortDistribution(0.002, 0.004);
+  std::uniform_real_distribution<double> longDistribution(0.010, 0.020);
+  for (size_t n = 0; n < 5000; ++n) {
+    linksLatencies.update(0, 1, shortDistribution(generator));
+    linksLatencies.update(1, 0, longDistribution(generator));
+  }
+
+  EXPECT_NEAR(linksLatencies.getLatencyQuantile(0, 1), 0.0039, 0.0003);
+  EXPECT_NEAR(linksLatencies.getLatencyQuantile(1, 0), 0.0195, 0.0015);
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestLinksLatencies, checkTimeouts)
+{
+  auto maximalTimeout = romea::core::durationFromMilliSecond(49);
+  romea::core::RTLSLinksLatencies linksLatencies(
+    1, 3, 0.95, 2.0, romea::core::durationFromMilliSecond(5));
+
+  for (size_t n = 0; n < 100; ++n) {
+    linksLatencies.update(0, 0, 0.0001);
+    linksLatencies.update(0, 1, 0.010);
+    linksLatencies.update(0, 2, 0.100);
+  }
+
+  EXPECT_EQ(linksLatencies.computeTimeout(0, 0, maximalTimeout),
+    romea::core::durationFromMilliSecond(5));
+  EXPECT_NEAR(
+    romea::core::durationToSecond(linksLatencies.computeTimeout(0, 1, maximalTimeout)),
+    0.020, 0.0001);
+  EXPECT_EQ(linksLatencies.computeTimeout(0, 2, maximalTimeout), maximalTimeout);
+
+  linksLatencies.addResponder();
+  EXPECT_EQ(linksLatencies.computeTimeout(0, 3, maximalTimeout), maximalTimeout);
+  EXPECT_NEAR(
+    romea::core::durationToSecond(linksLatencies.computeTimeout(0, 1, maximalTimeout)),
+    0.020, 0.0001);
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestLinksLatencies, checkFailedExchangesAreIgnored)
+{
+  romea::core::RTLSLinksLatencies linksLatencies(
+    1, 1, 0.95, 1.0, romea::core::durationFromMilliSecond(1));
+
+  romea::core::TimePoint stamp(romea::core::durationFromSecond(10));
+  for (size_t n = 0; n < 20; ++n) {
+    linksLatencies.request(0, 0, stamp);
+    stamp += romea::core::durationFromMilliSecond(n % 2 ? 3 : 40);
+    linksLatencies.feedback(0, 0, stamp, n % 2);
+  }
+
+  EXPECT_NEAR(linksLatencies.getLatencyQuantile(0, 0), 0.003, 0.0005);
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestLinksLatencies, checkStaleFeedbackIsIgnored)
+{
+  romea::core::RTLSLinksLatencies linksLatencies(
+    1, 1, 0.95, 1.0, romea::core::durationFromMilliSecond(1));
+
+  romea::core::TimePoint stamp(romea::core::durationFromSecond(10));
+  for (size_t n = 0; n < 20; ++n) {
+    romea::core::TimePoint requestStamp = stamp;
+    linksLatencies.request(0, 0, requestStamp);
+    stamp += romea::core::durationFromMilliSecond(3);
+    linksLatencies.feedback(0, 0, stamp, true, requestStamp);
+  }
+
+  // late answer of a previous request must not end the pending one
+  double quantile = linksLatencies.getLatencyQuantile(0, 0);
+  romea::core::TimePoint requestStamp = stamp;
+  linksLatencies.request(0, 0, requestStamp);
+  linksLatencies.feedback(
+    0, 0, stamp + romea::core::durationFromMilliSecond(1), true,
+    requestStamp - romea::core::durationFromMilliSecond(50));
+  EXPECT_DOUBLE_EQ(linksLatencies.getLatencyQuantile(0, 0), quantile);
+
+  linksLatencies.feedback(
+    0, 0, stamp + romea::core::durationFromMilliSecond(30), true, requestStamp);
+  EXPECT_GT(linksLatencies.getLatencyQuantile(0, 0), quantile);
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
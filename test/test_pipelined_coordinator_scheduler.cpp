@@ -0,0 +1,181 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+// gtest
+#include "gtest/gtest.h"
+
+// romea
+#include "romea_core_rtls/coordination/RTLSPipelinedCoordinatorScheduler.hpp"
+#include "romea_core_rtls/coordination/RTLSVirtualClock.hpp"
+
+class TestPipelinedCoordinatorScheduler : public ::testing::Test
+{
+protected:
+  TestPipelinedCoordinatorScheduler()
+  : clock_(std::make_shared<romea::core::RTLSVirtualClock>()),
+    scheduler_(nullptr),
+    requests_(),
+    requestsStamps_()
+  {
+  }
+
+  void init(
+    const double & pollRate,
+    const std::vector<std::string> & initiatorsNames,
+    const std::vector<std::string> & respondersNames)
+  {
+    auto callback = [this](
+      const size_t & initiatorIndex,
+      const size_t & responderIndex,
+      const romea::core::Duration & /*timeout*/)
+      {
+        requests_.emplace_back(initiatorIndex, responderIndex);
+        requestsStamps_.push_back(clock_->now());
+      };
+
+    scheduler_ = std::make_unique<romea::core::RTLSPipelinedCoordinatorScheduler>(
+      pollRate, initiatorsNames, respondersNames, callback, clock_);
+  }
+
+  std::shared_ptr<romea::core::RTLSVirtualClock> clock_;
+  std::unique_ptr<romea::core::RTLSPipelinedCoordinatorScheduler> scheduler_;
+  std::vector<std::pair<size_t, size_t>> requests_;
+  std::vector<romea::core::TimePoint> requestsStamps_;
+};
+
+TEST_F(TestPipelinedCoordinatorScheduler, checkConcurrentRequestsDoNotShareTransceivers)
+{
+  init(1.0, {"initiator0", "initiator1"}, {"responder0", "responder1", "responder2"});
+
+  romea::core::RTLSTransceiverRangingResult result;
+  result.range = 1.0;
+
+  scheduler_->start();
+  ASSERT_EQ(requests_.size(), 2);
+  EXPECT_EQ(scheduler_->getNumberOfInFlightRequests(), 2);
+  EXPECT_NE(requests_[0].first, requests_[1].first);
+  EXPECT_NE(requests_[0].second, requests_[1].second);
+
+  auto first = requests_[0];
+  scheduler_->feedback(first.first, first.second, result);
+  ASSERT_EQ(requests_.size(), 3);
+  EXPECT_EQ(requests_[2].first, first.first);
+  EXPECT_NE(requests_[2].second, first.second);
+  EXPECT_NE(requests_[2].second, requests_[1].second);
+
+  scheduler_->feedback(first.first, first.second, result);
+  EXPECT_EQ(requests_.size(), 3);
+
+  auto second = requests_[1];
+  scheduler_->feedback(second.first, second.second, result);
+  ASSERT_EQ(requests_.size(), 4);
+  EXPECT_EQ(requests_[3].first, second.first);
+  EXPECT_NE(requests_[3].second, requests_[2].second);
+  scheduler_->stop();
+
+  EXPECT_EQ(scheduler_->getNumberOfInFlightRequests(), 2);
+}
+
+TEST_F(TestPipelinedCoordinatorScheduler, checkTimedOutRequestsAreReleased)
+{
+  init(20.0, {"initiator0", "initiator1"}, {"responder0", "responder1"});
+
+  scheduler_->start();
+  clock_->advance(romea::core::durationFromSecond(0.5));
+  scheduler_->stop();
+
+  EXPECT_GE(requests_.size(), 6);
+  EXPECT_LE(requests_.size(), 22);
+  EXPECT_LE(scheduler_->getNumberOfInFlightRequests(), 2);
+}
+
+TEST_F(TestPipelinedCoordinatorScheduler, checkStaleFeedbackIsIgnored)
+{
+  init(20.0, {"initiator0"}, {"responder0"});
+
+  romea::core::RTLSTransceiverRangingResult result;
+  result.range = 1.0;
+
+  scheduler_->start();
+  clock_->advance(romea::core::durationFromSecond(0.12));
+  ASSERT_GE(requests_.size(), 2);
+
+  // late answer of a timed out request must not complete the request in progress
+  size_t numberOfRequests = requests_.size();
+  scheduler_->feedback(0, 0, result, requestsStamps_.front());
+  EXPECT_EQ(requests_.size(), numberOfRequests);
+  EXPECT_EQ(scheduler_->getNumberOfInFlightRequests(), 1);
+
+  scheduler_->feedback(0, 0, result, requestsStamps_.back());
+  EXPECT_EQ(requests_.size(), numberOfRequests + 1);
+  scheduler_->stop();
+}
+
+TEST_F(TestPipelinedCoordinatorScheduler, checkDispatchedRequestsTimeoutFromDispatch)
+{
+  init(20.0, {"initiator0"}, {"responder0"});
+
+  romea::core::RTLSTransceiverRangingResult result;
+  result.range = 1.0;
+
+  scheduler_->start();
+  ASSERT_EQ(requests_.size(), 1);
+
+  // request held by a channel arbiter is only sent later, with its own timeout
+  scheduler_->dispatch(0, 0, romea::core::durationFromSecond(0.3));
+  clock_->advance(romea::core::durationFromSecond(0.12));
+  EXPECT_EQ(requests_.size(), 1);
+  EXPECT_EQ(scheduler_->getNumberOfInFlightRequests(), 1);
+
+  scheduler_->feedback(0, 0, result, clock_->now());
+  EXPECT_EQ(requests_.size(), 2);
+  scheduler_->stop();
+}
+
+TEST_F(TestPipelinedCoordinatorScheduler, checkSuperframeSlotsArePolledConcurrently)
+{
+  init(1.0, {"initiator0", "initiator1"}, {"responder0", "responder1", "responder2"});
+  scheduler_->enableSuperframe();
+
+  romea::core::RTLSTransceiverRangingResult result;
+  result.range = 1.0;
+
+  // slots whose initiator or responder is busy are skipped
+  scheduler_->start();
+  ASSERT_EQ(requests_.size(), 2);
+  EXPECT_EQ(requests_[0], std::make_pair(size_t(0), size_t(0)));
+  EXPECT_EQ(requests_[1], std::make_pair(size_t(1), size_t(1)));
+
+  // frame ends on a busy slot, first slot of next frame is polled
+  scheduler_->feedback(1, 1, result);
+  scheduler_->feedback(0, 0, result);
+  ASSERT_EQ(requests_.size(), 4);
+  EXPECT_EQ(requests_[2], std::make_pair(size_t(1), size_t(2)));
+  EXPECT_EQ(requests_[3], std::make_pair(size_t(0), size_t(0)));
+  EXPECT_EQ(scheduler_->getNumberOfInFlightRequests(), 2);
+  scheduler_->stop();
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
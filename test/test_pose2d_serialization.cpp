@@ -141,6 +141,85 @@ TEST(TestSerialization, testPose2DSerialization)
   EXPECT_NEAR(std::sqrt(pose.covariance(2, 2)), std::sqrt(0.033), 0.1 * M_PI / 180.);
 }
 
+//-----------------------------------------------------------------------------
+TEST(TestSerialization, testPose2DSerializationIntoArray)
+{
+  romea::core::Pose2D pose;
+  pose.position = Eigen::Vector2d(-12.3456, 789.012);
+  pose.yaw = -0.734;
+  pose.covariance.diagonal() << 0.04, 0.01, 0.002;
+
+  romea::core::SerializedPose2D buffer;
+  romea::core::serializePose2D(pose, buffer);
+  std::vector<unsigned char> vectorBuffer = romea::core::serializePose2D(pose);
+  EXPECT_TRUE(std::equal(buffer.begin(), buffer.end(), vectorBuffer.begin(), vectorBuffer.end()));
+
+  romea::core::Pose2D deserializedPose = romea::core::deserializePose2D(buffer);
+  EXPECT_NEAR(deserializedPose.position.x(), -12.3456, 0.001);
+  EXPECT_NEAR(deserializedPose.position.y(), 789.012, 0.001);
+  EXPECT_NEAR(deserializedPose.yaw, -0.734, 0.01 * M_PI / 180.);
+
+  // in place deserialization clears cross covariances of previous pose
+  deserializedPose.covariance.setConstant(1.0);
+  romea::core::deserializePose2D(buffer.data(), deserializedPose);
+  EXPECT_NEAR(deserializedPose.covariance(0, 0), 0.04, 0.01);
+  EXPECT_DOUBLE_EQ(deserializedPose.covariance(0, 2), 0);
+  EXPECT_DOUBLE_EQ(deserializedPose.covariance(2, 1), 0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestSerialization, testPose2DBatchSerialization)
+{
+  std::vector<romea::core::Pose2D> poses(5);
+  for (size_t n = 0; n < poses.size(); ++n) {
+    poses[n].position = Eigen::Vector2d(10.5 * n, -3.25 * n);
+    poses[n].yaw = 0.1 * n;
+    poses[n].covariance.diagonal() << 0.01 * n, 0.01 * n, 0.001 * n;
+  }
+
+  std::vector<unsigned char> buffer(poses.size() * romea::core::POSE2D_SERIALIZED_SIZE);
+  romea::core::serializePose2DBatch(poses.data(), poses.size(), buffer.data());
+
+  std::vector<romea::core::Pose2D> deserializedPoses(poses.size());
+  romea::core::deserializePose2DBatch(buffer.data(), poses.size(), deserializedPoses.data());
+
+  for (size_t n = 0; n < poses.size(); ++n) {
+    auto first = buffer.begin() + n * romea::core::POSE2D_SERIALIZED_SIZE;
+    std::vector<unsigned char> poseBuffer = romea::core::serializePose2D(poses[n]);
+    EXPECT_TRUE(std::equal(poseBuffer.begin(), poseBuffer.end(), first));
+    EXPECT_NEAR(deserializedPoses[n].position.x(), poses[n].position.x(), 0.001);
+    EXPECT_NEAR(deserializedPoses[n].position.y(), poses[n].position.y(), 0.001);
+    EXPECT_NEAR(deserializedPoses[n].yaw, poses[n].yaw, 0.01 * M_PI / 180.);
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestSerialization, testPose2DSerializationRejectsInvalidValues)
+{
+  std::vector<unsigned char> buffer(romea::core::POSE2D_SERIALIZED_SIZE);
+  EXPECT_ANY_THROW(romea::core::serializeCartesianCoordinate(std::nan(""), buffer.data()));
+  EXPECT_ANY_THROW(romea::core::serializeOrientationVariance(-0.01, buffer.data()));
+  EXPECT_ANY_THROW(romea::core::serializeOrientationVariance(std::nan(""), buffer.data()));
+  EXPECT_ANY_THROW(
+    romea::core::serializePositionCovariance(
+      Eigen::Vector2d(0.01, -0.01).asDiagonal().toDenseMatrix(), buffer.data()));
+  EXPECT_ANY_THROW(
+    romea::core::serializePositionCovariance(
+      Eigen::Vector2d(0.01, std::nan("")).asDiagonal().toDenseMatrix(), buffer.data()));
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestSerialization, testPose2DBatchSerializationThrowsBeforeWriting)
+{
+  // invalid pose lies in second chunk of batch
+  std::vector<romea::core::Pose2D> poses(100);
+  poses[80].covariance(2, 2) = std::nan("");
+
+  std::vector<unsigned char> buffer(poses.size() * romea::core::POSE2D_SERIALIZED_SIZE, 0);
+  EXPECT_ANY_THROW(romea::core::serializePose2DBatch(poses.data(), poses.size(), buffer.data()));
+  EXPECT_EQ(buffer, std::vector<unsigned char>(buffer.size(), 0));
+}
+
 //-----------------------------------------------------------------------------
 int main(int argc, char ** argv)
 {
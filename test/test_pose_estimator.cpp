@@ -12,6 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+// Eigen
+#include <Eigen/Geometry>
+
 // std
 #include <vector>
 
@@ -63,6 +66,59 @@ TEST(TestRtlsPoseEstimator, testRtlsPoseEstimator)
   }
 }
 
+//-----------------------------------------------------------------------------
+TEST(TestRtlsPoseEstimator, testRtlsPoseEstimatorTracking)
+{
+  using RangeVector = std::vector<std::optional<double>>;
+  using RangeArray = std::vector<RangeVector>;
+
+  romea::core::VectorOfEigenVector3d tagPositions;
+  tagPositions.emplace_back(0, -0.3, 1.01);
+  tagPositions.emplace_back(0, 0.3, 1.01);
+  tagPositions.emplace_back(0.44, 0, 0.71);
+
+  romea::core::VectorOfEigenVector3d anchorPositions;
+  anchorPositions.emplace_back(0, -0.21, 0.39);
+  anchorPositions.emplace_back(0, 0.21, 0.39);
+  anchorPositions.emplace_back(0.85, 0, 0.44);
+
+  romea::core::RTLSPose2DEstimator estimator(anchorPositions, tagPositions, 0.001);
+  estimator.enableTracking(0.05, 1.0);
+
+  romea::core::Twist2D twist;
+  twist.linearSpeeds = Eigen::Vector2d(1.0, 0.3);
+  twist.angularSpeed = 0.2;
+
+  // body frame speeds are rotated by the estimated course before being integrated
+  double x = 5;
+  double y = 2;
+  double course = 0.5;
+  for (size_t n = 0; n < 10; ++n) {
+    Eigen::Vector2d speeds = Eigen::Rotation2Dd(course) * twist.linearSpeeds;
+    x += speeds.x() * 0.1;
+    y += speeds.y() * 0.1;
+    course += twist.angularSpeed * 0.1;
+
+    Eigen::Matrix3d R = romea::core::eulerAnglesToRotation3D(Eigen::Vector3d(0, 0, course));
+    Eigen::Vector3d T(x, y, 0);
+
+    RangeArray ranges(3, RangeVector(3));
+    for (size_t i = 0; i < 3; i++) {
+      for (size_t j = 0; j < 3; j++) {
+        ranges[i][j] = ((R * anchorPositions[i] + T) - tagPositions[j]).head<2>().norm();
+      }
+    }
+
+    estimator.predict(twist, 0.1);
+    EXPECT_TRUE(estimator.init(ranges));
+    EXPECT_TRUE(estimator.estimate(10, 0.02));
+    EXPECT_EQ(estimator.isTrackingGuessUsed(), n != 0);
+    EXPECT_NEAR(T[0], estimator.getEstimate()[0], 0.01);
+    EXPECT_NEAR(T[1], estimator.getEstimate()[1], 0.01);
+    EXPECT_NEAR(romea::core::betweenMinusPiAndPi(course - estimator.getEstimate()[2]), 0.0, 0.01);
+  }
+}
+
 //-----------------------------------------------------------------------------
 int main(int argc, char ** argv)
 {
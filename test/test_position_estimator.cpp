@@ -12,76 +12,110 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+// Eigen
+#include <Eigen/Geometry>
+
 // gtest
 #include "gtest/gtest.h"
 
 // romea
-#include "romea_core_common/containers/Eigen/VectorOfEigenVector.hpp"
 #include "romea_core_rtls/trilateration/RTLSPosition2DEstimator.hpp"
-
+#include "position_estimator_fixtures.hpp"
 
 //-----------------------------------------------------------------------------
-TEST(TestRtlsPositionEstimator, testPositionEstimatorWithTwoAnchors)
+void checkPositionEstimator(const PositionEstimatorFixture & fixture)
 {
-  auto tag0Position = Eigen::Vector3d(5.0, 2.0, 2.0);
-  auto anchor0Position = Eigen::Vector3d(0.0, 0.3, 1);
-  auto anchor1Position = Eigen::Vector3d(0.0, -0.3, 1);
-  double r00 = (tag0Position - anchor0Position).head<2>().norm();
-  double r01 = (tag0Position - anchor1Position).head<2>().norm();
-
-  romea::core::RTLSPosition2DEstimator estimator(
-    {anchor0Position, anchor1Position}, 0.001);
-  EXPECT_TRUE(estimator.init({r00, r01}));
+  romea::core::RTLSPosition2DEstimator estimator(fixture.anchorPositions, 0.001);
+  EXPECT_TRUE(estimator.init(computeRanges(fixture.tagPosition, fixture.anchorPositions)));
   EXPECT_TRUE(estimator.estimate(20, 0.02));
 
   auto tag0EstimatedPosition = estimator.getEstimate();
+  EXPECT_NEAR(fixture.tagPosition.x(), tag0EstimatedPosition.x(), 0.001);
+  EXPECT_NEAR(fixture.tagPosition.y(), tag0EstimatedPosition.y(), 0.001);
+}
 
-  EXPECT_NEAR(tag0Position.x(), tag0EstimatedPosition.x(), 0.001);
-  EXPECT_NEAR(tag0Position.y(), tag0EstimatedPosition.y(), 0.001);
+//-----------------------------------------------------------------------------
+TEST(TestRtlsPositionEstimator, testPositionEstimatorWithTwoAnchors)
+{
+  checkPositionEstimator(makeTwoAnchorsFixture());
 }
 
 //-----------------------------------------------------------------------------
 TEST(TestRtlsPositionEstimator, testPositionEstimatorWithThreeAnchorsUp)
 {
-  auto tag0Position = Eigen::Vector3d(-4, 6, 1);
-  auto anchor0Position = Eigen::Vector3d(0, 0.6, 2);
-  auto anchor1Position = Eigen::Vector3d(0, -0.6, 1.5);
-  auto anchor2Position = Eigen::Vector3d(1, 0, 1.8);
-  double r00 = (tag0Position - anchor0Position).head<2>().norm();
-  double r01 = (tag0Position - anchor1Position).head<2>().norm();
-  double r02 = (tag0Position - anchor2Position).head<2>().norm();
-
-
-  romea::core::RTLSPosition2DEstimator estimator(
-    {anchor0Position, anchor1Position, anchor2Position}, 0.001);
+  checkPositionEstimator(makeThreeAnchorsUpFixture());
+}
 
-  EXPECT_TRUE(estimator.init({r00, r01, r02}));
-  EXPECT_TRUE(estimator.estimate(20, 0.02));
+//-----------------------------------------------------------------------------
+TEST(TestRtlsPositionEstimator, testPositionEstimatorWithThreeAnchorsDown)
+{
+  checkPositionEstimator(makeThreeAnchorsDownFixture());
+}
 
-  auto tag0EstimatedPosition = estimator.getEstimate();
-  EXPECT_NEAR(tag0Position.x(), tag0EstimatedPosition.x(), 0.001);
-  EXPECT_NEAR(tag0Position.y(), tag0EstimatedPosition.y(), 0.001);
+//-----------------------------------------------------------------------------
+TEST(TestRtlsPositionEstimator, testPositionEstimatorTracking)
+{
+  auto fixture = makeThreeAnchorsUpFixture();
+  romea::core::RTLSPosition2DEstimator estimator(fixture.anchorPositions, 0.001);
+  estimator.enableTracking(0.05, 1.0);
+
+  romea::core::Twist2D twist;
+  twist.linearSpeeds = Eigen::Vector2d(2.0, -1.0);
+
+  // body frame speeds are rotated by the heading before being integrated
+  double heading = 0.8;
+  Eigen::Rotation2Dd rotation(heading);
+
+  Eigen::Vector3d tagPosition = fixture.tagPosition;
+  for (size_t n = 0; n < 20; ++n) {
+    tagPosition.head<2>() += rotation * twist.linearSpeeds * 0.1;
+    if (n == 10) {
+      tagPosition.x() += 5;
+    }
+
+    estimator.predict(twist, heading, 0.1);
+    EXPECT_TRUE(estimator.init(computeRanges(tagPosition, fixture.anchorPositions)));
+    EXPECT_TRUE(estimator.estimate(20, 0.02));
+    EXPECT_EQ(estimator.isTrackingGuessUsed(), n != 0 && n != 10);
+
+    auto tagEstimatedPosition = estimator.getEstimate();
+    EXPECT_NEAR(tagPosition.x(), tagEstimatedPosition.x(), 0.001);
+    EXPECT_NEAR(tagPosition.y(), tagEstimatedPosition.y(), 0.001);
+  }
 }
 
 //-----------------------------------------------------------------------------
-TEST(TestRtlsPositionEstimator, testPositionEstimatorWithThreeAnchorsDown)
+TEST(TestRtlsPositionEstimator, testPositionEstimatorWithRangesWeights)
 {
-  auto tag0Position = Eigen::Vector3d(-6, -7, 1);
-  auto anchor0Position = Eigen::Vector3d(0, 0.6, 2);
-  auto anchor1Position = Eigen::Vector3d(0, -0.6, 1.5);
-  auto anchor2Position = Eigen::Vector3d(-2, 0, 1.8);
-  double r00 = (tag0Position - anchor0Position).head<2>().norm();
-  double r01 = (tag0Position - anchor1Position).head<2>().norm();
-  double r02 = (tag0Position - anchor2Position).head<2>().norm();
-
-  romea::core::RTLSPosition2DEstimator estimator(
-    {anchor0Position, anchor1Position, anchor2Position}, 0.001);
-  EXPECT_TRUE(estimator.init({r00, r01, r02}));
+  romea::core::VectorOfEigenVector3d anchorPositions = {
+    Eigen::Vector3d(0, 0, 1.5),
+    Eigen::Vector3d(20, 0, 1.5),
+    Eigen::Vector3d(20, 20, 1.5),
+    Eigen::Vector3d(0, 20, 1.5)};
+
+  Eigen::Vector3d tagPosition(6, 8, 1);
+  romea::core::RTLSPosition2DEstimator::RangeVector ranges;
+  for (const auto & anchorPosition : anchorPositions) {
+    ranges.push_back((tagPosition - anchorPosition).head<2>().norm());
+  }
+  ranges[2] = ranges[2].value() + 1.0;
+
+  romea::core::RTLSPosition2DEstimator estimator(anchorPositions, 0.0001);
+  EXPECT_TRUE(estimator.init(ranges));
   EXPECT_TRUE(estimator.estimate(20, 0.02));
+  double error = (estimator.getEstimate() - tagPosition.head<2>()).norm();
 
-  auto tag0EstimatedPosition = estimator.getEstimate();
-  EXPECT_NEAR(tag0Position.x(), tag0EstimatedPosition.x(), 0.001);
-  EXPECT_NEAR(tag0Position.y(), tag0EstimatedPosition.y(), 0.001);
+  // a down weighted noisy range barely biases estimate
+  EXPECT_TRUE(estimator.init(ranges, {1, 1, 0.001, 1}));
+  EXPECT_TRUE(estimator.estimate(20, 0.02));
+  double weightedError = (estimator.getEstimate() - tagPosition.head<2>()).norm();
+  EXPECT_LT(weightedError, 0.01);
+  EXPECT_GT(error, 10 * weightedError);
+
+  // weights are reset by unweighted init
+  EXPECT_TRUE(estimator.init(ranges));
+  EXPECT_TRUE(estimator.estimate(20, 0.02));
+  EXPECT_NEAR((estimator.getEstimate() - tagPosition.head<2>()).norm(), error, 1e-6);
 }
 
 //-----------------------------------------------------------------------------
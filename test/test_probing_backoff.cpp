@@ -0,0 +1,152 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// gtest
+#include "gtest/gtest.h"
+
+// romea
+#include "romea_core_rtls/coordination/RTLSProbingBackoff.hpp"
+
+class TestProbingBackoff : public ::testing::Test
+{
+public:
+  TestProbingBackoff()
+  : backoff_(
+      2,
+      romea::core::durationFromMilliSecond(100),
+      romea::core::durationFromMilliSecond(400)),
+    stamp_(romea::core::durationFromSecond(10))
+  {
+  }
+
+  void elapse(const size_t & milliseconds)
+  {
+    stamp_ += romea::core::durationFromMilliSecond(milliseconds);
+  }
+
+  void exclude(const size_t & entityIndex)
+  {
+    for (size_t n = 0; n < 3; ++n) {
+      backoff_.feedback(entityIndex, stamp_, false, false);
+    }
+  }
+
+  romea::core::RTLSProbingBackoff backoff_;
+  romea::core::TimePoint stamp_;
+};
+
+//-----------------------------------------------------------------------------
+TEST_F(TestProbingBackoff, checkReliableEntitiesAreKept)
+{
+  for (size_t n = 0; n < 10; ++n) {
+    backoff_.feedback(0, stamp_, false, true);
+  }
+
+  EXPECT_FALSE(backoff_.isExcluded(0));
+  EXPECT_TRUE(backoff_.canPoll(0, stamp_));
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(TestProbingBackoff, checkUnreliableEntitiesAreExcludedAfterConsecutiveFailures)
+{
+  backoff_.feedback(0, stamp_, false, false);
+  backoff_.feedback(0, stamp_, true, false);
+  backoff_.feedback(0, stamp_, false, false);
+  backoff_.feedback(0, stamp_, false, false);
+  EXPECT_FALSE(backoff_.isExcluded(0));
+
+  backoff_.feedback(0, stamp_, false, false);
+  EXPECT_TRUE(backoff_.isExcluded(0));
+  EXPECT_FALSE(backoff_.canPoll(0, stamp_));
+  EXPECT_FALSE(backoff_.isExcluded(1));
+  EXPECT_TRUE(backoff_.canPoll(1, stamp_));
+  EXPECT_EQ(backoff_.getNumberOfExcludedEntities(), 1u);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(TestProbingBackoff, checkProbesAreOnlyConsumedWhenCommitted)
+{
+  exclude(0);
+
+  elapse(99);
+  EXPECT_FALSE(backoff_.canPoll(0, stamp_));
+  elapse(1);
+  EXPECT_TRUE(backoff_.canPoll(0, stamp_));
+  EXPECT_TRUE(backoff_.canPoll(0, stamp_));
+  EXPECT_EQ(backoff_.getNumberOfProbes(), 0u);
+
+  backoff_.commitProbe(0, stamp_);
+  EXPECT_FALSE(backoff_.canPoll(0, stamp_));
+  EXPECT_EQ(backoff_.getNumberOfProbes(), 1u);
+
+  // committing a request of an entity which is not excluded is not a probe
+  backoff_.commitProbe(1, stamp_);
+  EXPECT_TRUE(backoff_.canPoll(1, stamp_));
+  EXPECT_EQ(backoff_.getNumberOfProbes(), 1u);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(TestProbingBackoff, checkProbesBackoff)
+{
+  exclude(0);
+  elapse(100);
+  backoff_.commitProbe(0, stamp_);
+
+  elapse(5);
+  backoff_.feedback(0, stamp_, false, false);
+  EXPECT_EQ(backoff_.getProbePeriod(0), romea::core::durationFromMilliSecond(200));
+  elapse(199);
+  EXPECT_FALSE(backoff_.canPoll(0, stamp_));
+  elapse(1);
+  EXPECT_TRUE(backoff_.canPoll(0, stamp_));
+
+  for (size_t n = 0; n < 4; ++n) {
+    backoff_.feedback(0, stamp_, false, false);
+  }
+  EXPECT_EQ(backoff_.getProbePeriod(0), romea::core::durationFromMilliSecond(400));
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(TestProbingBackoff, checkEntitiesAreRestoredWhenTheyAnswer)
+{
+  exclude(0);
+  elapse(100);
+  backoff_.commitProbe(0, stamp_);
+  backoff_.feedback(0, stamp_, false, false);
+  elapse(200);
+  backoff_.commitProbe(0, stamp_);
+  backoff_.feedback(0, stamp_, true, false);
+
+  EXPECT_FALSE(backoff_.isExcluded(0));
+  EXPECT_TRUE(backoff_.canPoll(0, stamp_));
+  EXPECT_EQ(backoff_.getProbePeriod(0), romea::core::durationFromMilliSecond(100));
+  EXPECT_EQ(backoff_.getNumberOfExcludedEntities(), 0u);
+  EXPECT_EQ(backoff_.getNumberOfProbes(), 2u);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(TestProbingBackoff, checkAddEntities)
+{
+  backoff_.addEntities(2);
+  exclude(3);
+  EXPECT_TRUE(backoff_.isExcluded(3));
+  EXPECT_FALSE(backoff_.isExcluded(2));
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,204 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+// gtest
+#include "gtest/gtest.h"
+
+// romea
+#include "romea_core_rtls/serialization/LittleEndian.hpp"
+#include "romea_core_rtls/serialization/Pose2DSerialization.hpp"
+#include "romea_core_rtls/serialization/Quantization.hpp"
+
+bool areBitwiseEqual(const double & first, const double & second)
+{
+  return std::memcmp(&first, &second, sizeof(double)) == 0;
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestQuantization, checkLittleEndianUnalignedPacking)
+{
+  std::array<unsigned char, 7> buffer = {};
+  romea::core::storeLittleEndian(static_cast<uint32_t>(0x12345678), buffer.data() + 1);
+  romea::core::storeLittleEndian(static_cast<uint16_t>(0xABCD), buffer.data() + 5);
+
+  std::array<unsigned char, 7> expectedBuffer = {0, 0x78, 0x56, 0x34, 0x12, 0xCD, 0xAB};
+  EXPECT_EQ(buffer, expectedBuffer);
+  EXPECT_EQ(romea::core::loadLittleEndianUint32(buffer.data() + 1), 0x12345678u);
+  EXPECT_EQ(romea::core::loadLittleEndianUint16(buffer.data() + 5), 0xABCDu);
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestQuantization, checkWireFormat)
+{
+  std::array<unsigned char, 7> buffer = {};
+  romea::core::serializeCartesianCoordinate(-1.5, buffer.data() + 1);
+  romea::core::serialiazeOrientation(0, buffer.data() + 5);
+
+  // 2^31 - 1500 and 18000
+  std::array<unsigned char, 7> expectedBuffer = {0, 0x24, 0xFA, 0xFF, 0x7F, 0x50, 0x46};
+  EXPECT_EQ(buffer, expectedBuffer);
+
+  double value;
+  romea::core::deserializeCartesianCoordinate(buffer.data() + 1, value);
+  EXPECT_DOUBLE_EQ(value, -1.5);
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestQuantization, checkBatchKernelsMatchScalarCodecs)
+{
+  const size_t size = 101;
+  std::mt19937 generator(0);
+  std::vector<double> coordinates(size), orientations(size), orientationVariances(size), stds(size);
+  for (size_t n = 0; n < size; ++n) {
+    coordinates[n] = std::uniform_real_distribution<double>(-1000000, 1000000)(generator);
+    orientations[n] = std::uniform_real_distribution<double>(-M_PI, 2 * M_PI)(generator);
+    orientationVariances[n] = std::uniform_real_distribution<double>(0, 0.199)(generator);
+    stds[n] = std::uniform_real_distribution<double>(0, 2)(generator);
+  }
+
+  std::vector<uint32_t> coordinatesCodes(size);
+  std::vector<uint16_t> orientationsCodes(size);
+  std::vector<uint8_t> orientationVariancesCodes(size), stdsCodes(size);
+  romea::core::quantizeCartesianCoordinates(coordinates.data(), size, coordinatesCodes.data());
+  romea::core::quantizeOrientations(orientations.data(), size, orientationsCodes.data());
+  romea::core::quantizeOrientationVariances(
+    orientationVariances.data(), size, orientationVariancesCodes.data());
+  romea::core::quantizeCentimetricStds(stds.data(), size, stdsCodes.data());
+
+  std::vector<double> values(size), orientationValues(size), variances(size), stdVariances(size);
+  romea::core::dequantizeCartesianCoordinates(coordinatesCodes.data(), size, values.data());
+  romea::core::dequantizeOrientations(orientationsCodes.data(), size, orientationValues.data());
+  romea::core::dequantizeOrientationVariances(
+    orientationVariancesCodes.data(), size, variances.data());
+  romea::core::dequantizeCentimetricVariances(stdsCodes.data(), size, stdVariances.data());
+
+  for (size_t n = 0; n < size; ++n) {
+    unsigned char buffer[4];
+    double value;
+    romea::core::serializeCartesianCoordinate(coordinates[n], buffer);
+    EXPECT_EQ(romea::core::loadLittleEndianUint32(buffer), coordinatesCodes[n]);
+    romea::core::deserializeCartesianCoordinate(buffer, value);
+    EXPECT_TRUE(areBitwiseEqual(value, values[n]));
+
+    romea::core::serialiazeOrientation(orientations[n], buffer);
+    EXPECT_EQ(romea::core::loadLittleEndianUint16(buffer), orientationsCodes[n]);
+    romea::core::deserializeOrientation(buffer, value);
+    EXPECT_TRUE(areBitwiseEqual(value, orientationValues[n]));
+
+    romea::core::serializeOrientationVariance(orientationVariances[n], buffer);
+    EXPECT_EQ(buffer[0], orientationVariancesCodes[n]);
+    romea::core::deserializeOrientationVariance(buffer, value);
+    EXPECT_TRUE(areBitwiseEqual(value, variances[n]));
+
+    Eigen::Matrix2d covariance = Eigen::Matrix2d::Identity() * stds[n] * stds[n];
+    romea::core::serializePositionCovariance(covariance, buffer);
+    EXPECT_EQ(buffer[0], stdsCodes[n]);
+    romea::core::deserializePositionCovariance(buffer, covariance);
+    EXPECT_TRUE(areBitwiseEqual(covariance(0, 0), stdVariances[n]));
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestQuantization, checkAllOrientationCodesRoundTrip)
+{
+  std::vector<uint16_t> codes(65536);
+  for (size_t n = 0; n < codes.size(); ++n) {
+    codes[n] = static_cast<uint16_t>(n);
+  }
+
+  std::vector<double> orientations(codes.size());
+  romea::core::dequantizeOrientations(codes.data(), codes.size(), orientations.data());
+
+  // decoded values near -pi..pi are encoded back to same codes
+  std::vector<uint16_t> roundTripCodes(codes.size());
+  romea::core::quantizeOrientations(orientations.data(), 36001, roundTripCodes.data());
+  for (size_t n = 0; n <= 36000; ++n) {
+    unsigned char buffer[2];
+    romea::core::storeLittleEndian(codes[n], buffer);
+    double value;
+    romea::core::deserializeOrientation(buffer, value);
+    EXPECT_TRUE(areBitwiseEqual(value, orientations[n]));
+    EXPECT_LE(std::abs(static_cast<int>(roundTripCodes[n]) - static_cast<int>(n)), 1);
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestQuantization, checkKernelsThrowBeforeWriting)
+{
+  std::vector<double> coordinates = {1.0, 2000000.0, 3.0};
+  std::vector<uint32_t> codes(3, 0);
+  EXPECT_ANY_THROW(
+    romea::core::quantizeCartesianCoordinates(coordinates.data(), 3, codes.data()));
+  EXPECT_EQ(codes, std::vector<uint32_t>(3, 0));
+
+  std::vector<double> variances = {0.01, 0.2};
+  std::vector<uint8_t> varianceCodes(2, 0);
+  EXPECT_ANY_THROW(
+    romea::core::quantizeOrientationVariances(variances.data(), 2, varianceCodes.data()));
+  EXPECT_ANY_THROW(
+    romea::core::quantizeCentimetricStds(coordinates.data(), 3, varianceCodes.data()));
+  EXPECT_EQ(varianceCodes, std::vector<uint8_t>(2, 0));
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestQuantization, checkPose2DBatchMatchesScalarCodec)
+{
+  // more poses than a batch chunk
+  std::vector<romea::core::Pose2D> poses(150);
+  std::mt19937 generator(0);
+  for (auto & pose : poses) {
+    pose.position.x() = std::uniform_real_distribution<double>(-1000, 1000)(generator);
+    pose.position.y() = std::uniform_real_distribution<double>(-1000, 1000)(generator);
+    pose.yaw = std::uniform_real_distribution<double>(-M_PI, M_PI)(generator);
+    pose.covariance.diagonal() <<
+      std::uniform_real_distribution<double>(0, 4)(generator),
+      std::uniform_real_distribution<double>(0, 4)(generator),
+      std::uniform_real_distribution<double>(0, 0.199)(generator);
+  }
+
+  std::vector<unsigned char> buffer(poses.size() * romea::core::POSE2D_SERIALIZED_SIZE);
+  romea::core::serializePose2DBatch(poses.data(), poses.size(), buffer.data());
+  std::vector<romea::core::Pose2D> deserializedPoses(poses.size());
+  romea::core::deserializePose2DBatch(buffer.data(), poses.size(), deserializedPoses.data());
+
+  for (size_t n = 0; n < poses.size(); ++n) {
+    romea::core::SerializedPose2D poseBuffer;
+    romea::core::serializePose2D(poses[n], poseBuffer);
+    EXPECT_EQ(
+      std::memcmp(
+        poseBuffer.data(), buffer.data() + n * romea::core::POSE2D_SERIALIZED_SIZE,
+        poseBuffer.size()), 0);
+
+    romea::core::Pose2D pose = romea::core::deserializePose2D(poseBuffer);
+    EXPECT_TRUE(areBitwiseEqual(pose.position.x(), deserializedPoses[n].position.x()));
+    EXPECT_TRUE(areBitwiseEqual(pose.position.y(), deserializedPoses[n].position.y()));
+    EXPECT_TRUE(areBitwiseEqual(pose.yaw, deserializedPoses[n].yaw));
+    EXPECT_EQ(std::memcmp(pose.covariance.data(), deserializedPoses[n].covariance.data(),
+      9 * sizeof(double)), 0);
+  }
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
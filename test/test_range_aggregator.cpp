@@ -0,0 +1,207 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <memory>
+#include <vector>
+
+// gtest
+#include "gtest/gtest.h"
+
+// romea
+#include "romea_core_rtls/coordination/RTLSRangeAggregator.hpp"
+#include "romea_core_rtls/coordination/RTLSVirtualClock.hpp"
+
+class TestRangeAggregator : public ::testing::Test
+{
+protected:
+  TestRangeAggregator()
+  : aggregator_(nullptr),
+    emittedRanges_(),
+    stamp_(romea::core::durationFromSecond(100))
+  {
+  }
+
+  void init(
+    const double & maximalRangeAge,
+    const double & window,
+    const size_t & minimalNumberOfNewRangesPerInitiator)
+  {
+    aggregator_ = std::make_unique<romea::core::RTLSRangeAggregator>(
+      2, 3,
+      romea::core::durationFromSecond(maximalRangeAge),
+      romea::core::durationFromSecond(window),
+      minimalNumberOfNewRangesPerInitiator,
+      [this](const romea::core::RTLSRangeAggregator::RangeArray & ranges) {
+        emittedRanges_.push_back(ranges);
+      });
+  }
+
+  void update(const size_t & initiatorIndex, const size_t & responderIndex, const double & range)
+  {
+    romea::core::RTLSTransceiverRangingResult result;
+    result.range = range;
+    stamp_ += romea::core::durationFromMilliSecond(10);
+    aggregator_->update(initiatorIndex, responderIndex, result, stamp_);
+  }
+
+  void poll(const double & elapsedTime)
+  {
+    stamp_ += romea::core::durationFromSecond(elapsedTime);
+    aggregator_->poll(stamp_);
+  }
+
+  std::unique_ptr<romea::core::RTLSRangeAggregator> aggregator_;
+  std::vector<romea::core::RTLSRangeAggregator::RangeArray> emittedRanges_;
+  romea::core::TimePoint stamp_;
+};
+
+//-----------------------------------------------------------------------------
+TEST_F(TestRangeAggregator, checkEmissionWhenCoverageIsReached)
+{
+  init(1.0, 10.0, 2);
+
+  update(0, 0, 1.0);
+  update(0, 1, 2.0);
+  update(0, 0, 1.5);
+  EXPECT_TRUE(emittedRanges_.empty());
+
+  update(1, 2, 3.0);
+  EXPECT_TRUE(emittedRanges_.empty());
+  update(1, 1, 4.0);
+  ASSERT_EQ(emittedRanges_.size(), 1u);
+
+  const auto & ranges = emittedRanges_[0];
+  EXPECT_DOUBLE_EQ(*ranges[0][0], 1.5);
+  EXPECT_DOUBLE_EQ(*ranges[0][1], 2.0);
+  EXPECT_FALSE(ranges[0][2].has_value());
+  EXPECT_FALSE(ranges[1][0].has_value());
+  EXPECT_DOUBLE_EQ(*ranges[1][1], 4.0);
+  EXPECT_DOUBLE_EQ(*ranges[1][2], 3.0);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(TestRangeAggregator, checkEmissionWhenWindowIsElapsed)
+{
+  init(1.0, 0.05, 3);
+
+  update(0, 0, 1.0);
+  update(0, 1, 2.0);
+  update(1, 1, 2.0);
+  update(0, 2, 2.0);
+  update(1, 2, 2.0);
+  EXPECT_TRUE(emittedRanges_.empty());
+  update(1, 1, 2.5);
+  ASSERT_EQ(emittedRanges_.size(), 1u);
+  EXPECT_DOUBLE_EQ(*emittedRanges_[0][1][1], 2.5);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(TestRangeAggregator, checkOldRangesAreDiscarded)
+{
+  init(0.1, 10, 1);
+
+  update(0, 0, 1.0);
+  for (size_t n = 0; n < 10; ++n) {
+    update(0, 1, 2.0);
+  }
+  update(1, 1, 1.0);
+
+  ASSERT_EQ(emittedRanges_.size(), 1u);
+  EXPECT_FALSE(emittedRanges_[0][0][0].has_value());
+  EXPECT_DOUBLE_EQ(*emittedRanges_[0][0][1], 2.0);
+  EXPECT_DOUBLE_EQ(*emittedRanges_[0][1][1], 1.0);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(TestRangeAggregator, checkFailedRangingIsIgnored)
+{
+  init(1.0, 10.0, 1);
+
+  update(0, 0, 0.0);
+  update(1, 0, 1.0);
+  EXPECT_TRUE(emittedRanges_.empty());
+  update(0, 2, 1.0);
+  ASSERT_EQ(emittedRanges_.size(), 1u);
+  EXPECT_FALSE(emittedRanges_[0][0][0].has_value());
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(TestRangeAggregator, checkEmissionWhenFeedbackStops)
+{
+  init(1.0, 0.1, 3);
+
+  update(0, 0, 1.0);
+  update(1, 2, 3.0);
+  poll(0.05);
+  EXPECT_TRUE(emittedRanges_.empty());
+
+  poll(0.05);
+  ASSERT_EQ(emittedRanges_.size(), 1u);
+  EXPECT_DOUBLE_EQ(*emittedRanges_[0][0][0], 1.0);
+  EXPECT_DOUBLE_EQ(*emittedRanges_[0][1][2], 3.0);
+
+  poll(0.2);
+  EXPECT_EQ(emittedRanges_.size(), 1u);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(TestRangeAggregator, checkNothingIsEmittedWithoutFeedback)
+{
+  init(1.0, 0.1, 1);
+
+  for (size_t n = 0; n < 10; ++n) {
+    poll(0.05);
+  }
+  EXPECT_TRUE(emittedRanges_.empty());
+
+  update(0, 1, 2.0);
+  EXPECT_TRUE(emittedRanges_.empty());
+  poll(0.1);
+  ASSERT_EQ(emittedRanges_.size(), 1u);
+  EXPECT_DOUBLE_EQ(*emittedRanges_[0][0][1], 2.0);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(TestRangeAggregator, checkPollingFromClockTicker)
+{
+  init(1.0, 0.1, 3);
+
+  romea::core::RTLSVirtualClock clock(stamp_);
+  auto ticker = clock.createTicker(
+    [&]() {
+      aggregator_->poll(clock.now());
+    }, romea::core::durationFromMilliSecond(20));
+  ticker->start();
+
+  // window starts with the update and ends on the first tick after 100 ms
+  update(0, 0, 1.0);
+  clock.advanceTo(stamp_ + romea::core::durationFromMilliSecond(100));
+  EXPECT_TRUE(emittedRanges_.empty());
+
+  clock.advanceTo(stamp_ + romea::core::durationFromMilliSecond(110));
+  ASSERT_EQ(emittedRanges_.size(), 1u);
+  EXPECT_DOUBLE_EQ(*emittedRanges_[0][0][0], 1.0);
+
+  clock.advance(romea::core::durationFromSecond(0.5));
+  EXPECT_EQ(emittedRanges_.size(), 1u);
+  ticker->stop();
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
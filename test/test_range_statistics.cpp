@@ -0,0 +1,223 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// gtest
+#include "gtest/gtest.h"
+
+// Eigen
+#include <Eigen/Core>
+
+// std
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+// romea
+#include "romea_core_rtls/coordination/RTLSRangeStatistics.hpp"
+#include "romea_core_rtls/coordination/RTLSStreamingQuantile.hpp"
+
+class TestRangeStatistics : public ::testing::Test
+{
+public:
+  TestRangeStatistics()
+  : statistics_(2, 3, 0.1, 1.0),
+    generator_(0),
+    stamp_()
+  {
+  }
+
+  // tag slowly moving away from responder, ranges are blurred by gaussian noise
+  void measure(
+    const size_t & initiatorIndex,
+    const size_t & responderIndex,
+    const double & rangeStd,
+    const size_t & numberOfRanges)
+  {
+    std::normal_distribution<double> noise(0, rangeStd);
+    for (size_t n = 0; n < numberOfRanges; ++n) {
+      update(initiatorIndex, responderIndex, 10 + 0.01 * n + noise(generator_));
+    }
+  }
+
+  // ranges are measured every 100ms
+  void update(const size_t & initiatorIndex, const size_t & responderIndex, const double & range)
+  {
+    stamp_ += romea::core::durationFromMilliSecond(100);
+    statistics_.update(initiatorIndex, responderIndex, range, stamp_);
+  }
+
+  romea::core::RTLSRangeStatistics statistics_;
+  std::mt19937 generator_;
+  romea::core::TimePoint stamp_;
+};
+
+//-----------------------------------------------------------------------------
+TEST(TestStreamingQuantile, checkQuantileOfFewSamplesIsExact)
+{
+  romea::core::RTLSStreamingQuantile median(0.5);
+  EXPECT_TRUE(std::isnan(median.get()));
+
+  median.update(3);
+  median.update(1);
+  median.update(2);
+  EXPECT_DOUBLE_EQ(median.get(), 2);
+  EXPECT_EQ(median.getNumberOfSamples(), 3u);
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestStreamingQuantile, checkQuantilesOfUniformDistribution)
+{
+  romea::core::RTLSStreamingQuantile median(0.5);
+  romea::core::RTLSStreamingQuantile highQuantile(0.95);
+
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<double> distribution(0, 10);
+  for (size_t n = 0; n < 10000; ++n) {
+    double sample = distribution(generator);
+    median.update(sample);
+    highQuantile.update(sample);
+  }
+
+  EXPECT_NEAR(median.get(), 5, 0.2);
+  EXPECT_NEAR(highQuantile.get(), 9.5, 0.2);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(TestRangeStatistics, checkNominalWeightBeforeEnoughRanges)
+{
+  measure(0, 1, 1.0, 5);
+
+  romea::core::RTLSLinkRangeStatistics linkStatistics = statistics_.get(0, 1);
+  EXPECT_EQ(linkStatistics.numberOfRanges, 5u);
+  EXPECT_DOUBLE_EQ(linkStatistics.rangeStd, 0.1);
+  EXPECT_DOUBLE_EQ(linkStatistics.weight, 1.0);
+  EXPECT_DOUBLE_EQ(statistics_.getRangeWeight(1, 1), 1.0);
+  EXPECT_TRUE(std::isnan(statistics_.get(1, 1).lastRange));
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(TestRangeStatistics, checkInnovationsStatistics)
+{
+  measure(1, 2, 0.2, 5000);
+
+  // innovations of independent noises have twice their variance
+  romea::core::RTLSLinkRangeStatistics linkStatistics = statistics_.get(1, 2);
+  EXPECT_NEAR(linkStatistics.innovationMean, 0, 0.01);
+  EXPECT_NEAR(linkStatistics.innovationStd, 0.2 * std::sqrt(2), 0.01);
+  EXPECT_NEAR(linkStatistics.rangeStd, 0.2, 0.01);
+  EXPECT_NEAR(linkStatistics.weight, 0.25, 0.03);
+
+  // half normal median and 95th percentile
+  EXPECT_NEAR(linkStatistics.medianAbsoluteInnovation, 0.6745 * 0.2 * std::sqrt(2), 0.02);
+  EXPECT_NEAR(linkStatistics.highAbsoluteInnovation, 1.96 * 0.2 * std::sqrt(2), 0.04);
+  EXPECT_LT(linkStatistics.numberOfJumps, 5u);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(TestRangeStatistics, checkJumpsAreCounted)
+{
+  measure(0, 0, 0.01, 20);
+  update(0, 0, 15);
+  update(0, 0, 10.2);
+
+  EXPECT_EQ(statistics_.get(0, 0).numberOfJumps, 2u);
+  EXPECT_DOUBLE_EQ(statistics_.get(0, 0).lastRange, 10.2);
+  EXPECT_LT(statistics_.getRangeWeight(0, 0), 0.02);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(TestRangeStatistics, checkNoisyLinkIsDownWeighted)
+{
+  measure(0, 0, 0.05, 200);
+  measure(0, 1, 0.5, 200);
+  measure(1, 1, 0.05, 200);
+
+  std::vector<double> weights;
+  statistics_.getRangesWeights(0, weights);
+  ASSERT_EQ(weights.size(), 3u);
+  EXPECT_DOUBLE_EQ(weights[0], 1.0);
+  EXPECT_NEAR(weights[1], 0.04, 0.01);
+  EXPECT_DOUBLE_EQ(weights[2], 1.0);
+  EXPECT_DOUBLE_EQ(statistics_.getRangeWeight(1, 1), 1.0);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(TestRangeStatistics, checkNoisyLinkRegainsWeightOnceClean)
+{
+  measure(0, 1, 0.5, 200);
+  EXPECT_LT(statistics_.getRangeWeight(0, 1), 0.1);
+
+  measure(0, 1, 0.05, 500);
+  EXPECT_DOUBLE_EQ(statistics_.getRangeWeight(0, 1), 1.0);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(TestRangeStatistics, checkMovingTagKeepsCleanLinksWeights)
+{
+  // tag turning around the field at 2m/s, links are polled at irregular intervals
+  // and the robot is out of range for a while
+  const std::vector<Eigen::Vector2d> respondersPositions = {{0, 0}, {20, 0}, {0, 20}};
+  std::uniform_int_distribution<size_t> initiatorDistribution(0, 1);
+  std::uniform_int_distribution<size_t> responderDistribution(0, 2);
+  std::uniform_int_distribution<int> intervalDistribution(10, 80);
+  std::normal_distribution<double> noise(0, 0.05);
+
+  double minimalWeight = 1.0;
+  romea::core::TimePoint start = stamp_;
+  while (stamp_ - start < romea::core::durationFromSecond(120)) {
+    stamp_ += romea::core::durationFromMilliSecond(intervalDistribution(generator_));
+    double time = romea::core::durationToSecond(stamp_ - start);
+    if (time > 60 && time < 65) {
+      continue;
+    }
+
+    Eigen::Vector2d tagPosition(10 + 8 * std::cos(time / 4), 10 + 8 * std::sin(time / 4));
+    size_t initiatorIndex = initiatorDistribution(generator_);
+    size_t responderIndex = responderDistribution(generator_);
+    double range = (tagPosition - respondersPositions[responderIndex]).norm();
+    statistics_.update(initiatorIndex, responderIndex, range + noise(generator_), stamp_);
+
+    if (time > 10) {
+      minimalWeight = std::min(
+        minimalWeight, statistics_.getRangeWeight(initiatorIndex, responderIndex));
+    }
+  }
+
+  EXPECT_GT(minimalWeight, 0.9);
+  for (size_t r = 0; r < 3; ++r) {
+    EXPECT_EQ(statistics_.get(0, r).numberOfJumps, 0u);
+    EXPECT_EQ(statistics_.get(1, r).numberOfJumps, 0u);
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(TestRangeStatistics, checkAddedResponder)
+{
+  EXPECT_EQ(statistics_.addResponder(), 3u);
+  measure(1, 3, 0.5, 200);
+
+  std::vector<double> weights;
+  statistics_.getRangesWeights(1, weights);
+  ASSERT_EQ(weights.size(), 4u);
+  EXPECT_LT(weights[3], 0.1);
+  EXPECT_EQ(statistics_.get(0, 3).numberOfRanges, 0u);
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,144 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <random>
+#include <vector>
+
+// gtest
+#include "gtest/gtest.h"
+
+// romea
+#include "romea_core_rtls/coordination/RTLSReachableTransceivers.hpp"
+
+namespace
+{
+
+romea::core::VectorOfEigenVector3d makePoints(const size_t & numberOfPoints)
+{
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<double> distribution(-100, 100);
+
+  romea::core::VectorOfEigenVector3d points;
+  for (size_t n = 0; n < numberOfPoints; ++n) {
+    points.emplace_back(distribution(generator), distribution(generator), 2.0);
+  }
+  return points;
+}
+
+std::vector<size_t> bruteForceResearch(
+  const romea::core::VectorOfEigenVector3d & points,
+  const Eigen::Vector3d & position,
+  const double & researchRadius)
+{
+  std::vector<size_t> indexes;
+  for (size_t n = 0; n < points.size(); ++n) {
+    if ((points[n] - position).norm() <= researchRadius) {
+      indexes.push_back(n);
+    }
+  }
+  return indexes;
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+TEST(TestReachableTransceivers, checkResearchMatchesBruteForce)
+{
+  auto points = makePoints(2000);
+  romea::core::RTLSReachableTransceivers reachableTransceivers(points, 15.0);
+
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<double> distribution(-130, 130);
+  for (size_t n = 0; n < 200; ++n) {
+    Eigen::Vector3d position(distribution(generator), distribution(generator), 0.0);
+    EXPECT_EQ(
+      reachableTransceivers.find(position),
+      bruteForceResearch(points, position, 15.0));
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestReachableTransceivers, checkResearchWhenThereIsNoPoints)
+{
+  romea::core::RTLSReachableTransceivers reachableTransceivers({}, 15.0);
+  EXPECT_TRUE(reachableTransceivers.find(Eigen::Vector3d::Zero()).empty());
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestReachableTransceivers, checkResearchIsOnlyDoneOutsideHysteresisRegion)
+{
+  auto points = makePoints(2000);
+  romea::core::RTLSReachableTransceivers reachableTransceivers(points, 15.0, 1.0);
+
+  for (size_t n = 0; n <= 100; ++n) {
+    Eigen::Vector3d position(-50.0 + 0.05 * n, 10.0, 0.0);
+    EXPECT_EQ(
+      reachableTransceivers.find(position),
+      bruteForceResearch(points, position, 15.0));
+  }
+
+  EXPECT_EQ(reachableTransceivers.getNumberOfResearches(), 5);
+
+  reachableTransceivers.setHysteresisDistance(0);
+  Eigen::Vector3d position(-45.0, 10.0, 0.0);
+  EXPECT_EQ(reachableTransceivers.find(position), bruteForceResearch(points, position, 15.0));
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestReachableTransceivers, checkResearchAfterPointsAreAddedRemovedAndMoved)
+{
+  auto points = makePoints(500);
+  romea::core::RTLSReachableTransceivers reachableTransceivers(points, 15.0);
+
+  std::mt19937 generator(2);
+  std::uniform_real_distribution<double> distribution(-150, 150);
+  std::vector<bool> removed(points.size(), false);
+  for (size_t n = 0; n < 300; ++n) {
+    Eigen::Vector3d point(distribution(generator), distribution(generator), 2.0);
+    switch (n % 3) {
+      case 0:
+        points.push_back(point);
+        removed.push_back(false);
+        EXPECT_EQ(reachableTransceivers.add(point), points.size() - 1);
+        break;
+      case 1:
+        removed[n] = true;
+        reachableTransceivers.remove(n);
+        break;
+      case 2:
+        points[n] = point;
+        reachableTransceivers.update(n, point);
+        break;
+    }
+  }
+
+  for (size_t n = 0; n < 200; ++n) {
+    Eigen::Vector3d position(distribution(generator), distribution(generator), 0.0);
+    std::vector<size_t> expected;
+    for (const size_t & index : bruteForceResearch(points, position, 15.0)) {
+      if (!removed[index]) {
+        expected.push_back(index);
+      }
+    }
+    EXPECT_EQ(reachableTransceivers.find(position), expected);
+  }
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
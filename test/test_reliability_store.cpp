@@ -0,0 +1,134 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <atomic>
+#include <thread>
+
+// gtest
+#include "gtest/gtest.h"
+
+// romea
+#include "romea_core_rtls/coordination/RTLSReliabilityStore.hpp"
+
+using romea::core::DiagnosticStatus;
+using romea::core::RTLSReliabilityStore;
+
+//-----------------------------------------------------------------------------
+TEST(TestReliabilityStore, checkStatusesAreStaleBeforeFirstUpdate)
+{
+  RTLSReliabilityStore store(3, 4, 0.3, 0.8);
+  EXPECT_EQ(store.size(), 3);
+  for (size_t n = 0; n < store.size(); ++n) {
+    EXPECT_EQ(store.getStatus(n), DiagnosticStatus::STALE);
+    EXPECT_EQ(store.getNumberOfSamples(n), 0);
+    EXPECT_DOUBLE_EQ(store.getReliability(n), 0);
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestReliabilityStore, checkReliabilityIsAveragedOverSlidingWindow)
+{
+  RTLSReliabilityStore store(2, 4, 0.3, 0.8);
+
+  store.update(1, 3);
+  store.update(1, 1);
+  EXPECT_EQ(store.getNumberOfSamples(1), 2);
+  EXPECT_DOUBLE_EQ(store.getReliability(1), 4 / 6.);
+
+  store.update(1, 0);
+  store.update(1, 3);
+  store.update(1, 3);
+  EXPECT_EQ(store.getNumberOfSamples(1), 4);
+  EXPECT_DOUBLE_EQ(store.getReliability(1), 7 / 12.);
+
+  EXPECT_EQ(store.getNumberOfSamples(0), 0);
+  EXPECT_EQ(store.getStatus(0), DiagnosticStatus::STALE);
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestReliabilityStore, checkStatusFollowsThresholds)
+{
+  RTLSReliabilityStore store(1, 5, 0.3, 0.8);
+
+  for (size_t n = 0; n < 5; ++n) {
+    store.update(0, 3);
+  }
+  EXPECT_EQ(store.getStatus(0), DiagnosticStatus::OK);
+
+  store.update(0, 0);
+  EXPECT_EQ(store.getStatus(0), DiagnosticStatus::OK);
+  store.update(0, 0);
+  EXPECT_EQ(store.getStatus(0), DiagnosticStatus::WARN);
+  store.update(0, 0);
+  store.update(0, 0);
+  EXPECT_EQ(store.getStatus(0), DiagnosticStatus::ERROR);
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestReliabilityStore, checkCopyIntoLargerStoreKeepsWindows)
+{
+  RTLSReliabilityStore store(2, 3, 0.3, 0.8);
+  store.update(0, 0);
+  store.update(0, 3);
+  store.update(1, 1);
+
+  RTLSReliabilityStore largerStore(store, 4);
+  EXPECT_EQ(largerStore.size(), 2);
+  EXPECT_EQ(largerStore.capacity(), 4);
+  EXPECT_EQ(largerStore.add(), 2);
+  EXPECT_EQ(largerStore.size(), 3);
+  EXPECT_EQ(largerStore.getStatus(2), DiagnosticStatus::STALE);
+
+  largerStore.update(0, 3);
+  largerStore.update(0, 3);
+  EXPECT_EQ(largerStore.getNumberOfSamples(0), 3);
+  EXPECT_DOUBLE_EQ(largerStore.getReliability(0), 1);
+  EXPECT_DOUBLE_EQ(largerStore.getReliability(1), 1 / 3.);
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestReliabilityStore, checkReadersAlwaysGetConsistentReliabilities)
+{
+  RTLSReliabilityStore store(1, 8, 0.3, 0.8);
+  std::atomic<bool> isRunning(true);
+
+  // writer alternates two failures and six successes so that any full window
+  // holds the same reliability
+  std::thread writer([&]() {
+      for (size_t n = 0; n < 200000; ++n) {
+        store.update(0, n % 4 == 0 ? 0 : 3);
+      }
+      isRunning = false;
+    });
+
+  size_t numberOfInconsistentValues = 0;
+  while (isRunning) {
+    if (store.getNumberOfSamples(0) == 8 && store.getReliability(0) != 0.75) {
+      ++numberOfInconsistentValues;
+    }
+  }
+  writer.join();
+
+  EXPECT_EQ(numberOfInconsistentValues, 0);
+  EXPECT_DOUBLE_EQ(store.getReliability(0), 0.75);
+  EXPECT_EQ(store.getStatus(0), DiagnosticStatus::WARN);
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
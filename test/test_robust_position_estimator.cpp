@@ -0,0 +1,110 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <vector>
+
+// gtest
+#include "gtest/gtest.h"
+
+// romea
+#include "romea_core_common/containers/Eigen/VectorOfEigenVector.hpp"
+#include "romea_core_rtls/trilateration/RTLSPosition2DEstimator.hpp"
+#include "romea_core_rtls/trilateration/RTLSRobustPosition2DEstimator.hpp"
+
+class TestRtlsRobustPositionEstimator : public ::testing::TestWithParam<
+    romea::core::RTLSRobustPosition2DEstimator::Loss>
+{
+protected:
+  TestRtlsRobustPositionEstimator()
+  : anchorPositions_({
+      Eigen::Vector3d(-10, -10, 2),
+      Eigen::Vector3d(10, -10, 2),
+      Eigen::Vector3d(10, 10, 2),
+      Eigen::Vector3d(-10, 10, 2),
+      Eigen::Vector3d(0, 12, 2),
+      Eigen::Vector3d(12, 0, 2)}),
+    tagPosition_(3, -2, 1)
+  {
+  }
+
+  romea::core::RTLSPosition2DEstimator::RangeVector computeRanges()
+  {
+    romea::core::RTLSPosition2DEstimator::RangeVector ranges;
+    for (const auto & anchorPosition : anchorPositions_) {
+      ranges.push_back((tagPosition_ - anchorPosition).head<2>().norm());
+    }
+    return ranges;
+  }
+
+  romea::core::VectorOfEigenVector3d anchorPositions_;
+  Eigen::Vector3d tagPosition_;
+};
+
+//-----------------------------------------------------------------------------
+TEST_P(TestRtlsRobustPositionEstimator, testWithoutOutlier)
+{
+  romea::core::RTLSRobustPosition2DEstimator estimator(anchorPositions_, 0.001, GetParam());
+  EXPECT_TRUE(estimator.init(computeRanges()));
+  EXPECT_TRUE(estimator.estimate(20, 0.02));
+  EXPECT_NEAR(tagPosition_.x(), estimator.getEstimate().x(), 0.001);
+  EXPECT_NEAR(tagPosition_.y(), estimator.getEstimate().y(), 0.001);
+  EXPECT_EQ(estimator.getInliersIndexes(), std::vector<size_t>({0, 1, 2, 3, 4, 5}));
+}
+
+//-----------------------------------------------------------------------------
+TEST_P(TestRtlsRobustPositionEstimator, testWithNonLineOfSightRange)
+{
+  auto ranges = computeRanges();
+  ranges[2] = *ranges[2] + 3.0;
+
+  romea::core::RTLSPosition2DEstimator estimator(anchorPositions_, 0.001);
+  EXPECT_TRUE(estimator.init(ranges));
+  EXPECT_TRUE(estimator.estimate(20, 0.02));
+  EXPECT_GT((estimator.getEstimate() - tagPosition_.head<2>()).norm(), 0.5);
+
+  romea::core::RTLSRobustPosition2DEstimator robustEstimator(anchorPositions_, 0.001, GetParam());
+  EXPECT_TRUE(robustEstimator.init(ranges));
+  EXPECT_TRUE(robustEstimator.estimate(20, 0.02));
+  EXPECT_NEAR(tagPosition_.x(), robustEstimator.getEstimate().x(), 0.1);
+  EXPECT_NEAR(tagPosition_.y(), robustEstimator.getEstimate().y(), 0.1);
+  EXPECT_EQ(robustEstimator.getInliersIndexes(), std::vector<size_t>({0, 1, 3, 4, 5}));
+}
+
+//-----------------------------------------------------------------------------
+TEST_P(TestRtlsRobustPositionEstimator, testHypothesesBudget)
+{
+  auto ranges = computeRanges();
+  ranges[2] = *ranges[2] + 3.0;
+
+  romea::core::RTLSRobustPosition2DEstimator estimator(
+    anchorPositions_, 0.001, GetParam(), 0.2, 0.5, 4);
+  EXPECT_TRUE(estimator.init(ranges));
+  EXPECT_TRUE(estimator.estimate(20, 0.02));
+  EXPECT_EQ(estimator.getNumberOfEvaluatedHypotheses(), 4u);
+  EXPECT_NEAR(tagPosition_.x(), estimator.getEstimate().x(), 0.1);
+  EXPECT_NEAR(tagPosition_.y(), estimator.getEstimate().y(), 0.1);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  Losses, TestRtlsRobustPositionEstimator, ::testing::Values(
+    romea::core::RTLSRobustPosition2DEstimator::Loss::HUBER,
+    romea::core::RTLSRobustPosition2DEstimator::Loss::TUKEY));
+
+//-----------------------------------------------------------------------------
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
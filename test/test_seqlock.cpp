@@ -0,0 +1,86 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <array>
+#include <atomic>
+#include <thread>
+
+// gtest
+#include "gtest/gtest.h"
+
+// romea
+#include "romea_core_rtls/coordination/RTLSSeqLock.hpp"
+
+namespace
+{
+struct Sample
+{
+  std::array<double, 3> values;
+  int64_t counter;
+};
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestSeqLock, checkStoreAndLoad)
+{
+  romea::core::RTLSSeqLock<Sample> seqLock;
+  EXPECT_EQ(seqLock.load().counter, 0);
+
+  seqLock.store({{1.0, 2.0, 3.0}, 4});
+  Sample sample = seqLock.load();
+  EXPECT_DOUBLE_EQ(sample.values[0], 1.0);
+  EXPECT_DOUBLE_EQ(sample.values[1], 2.0);
+  EXPECT_DOUBLE_EQ(sample.values[2], 3.0);
+  EXPECT_EQ(sample.counter, 4);
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestSeqLock, checkReadersAlwaysGetConsistentValues)
+{
+  romea::core::RTLSSeqLock<Sample> seqLock;
+  std::atomic<bool> isRunning(true);
+
+  std::thread writer([&]() {
+      for (int64_t n = 1; n <= 200000; ++n) {
+        double value = static_cast<double>(n);
+        seqLock.store({{value, -value, 2 * value}, n});
+      }
+      isRunning = false;
+    });
+
+  size_t numberOfInconsistentValues = 0;
+  int64_t lastCounter = 0;
+  while (isRunning) {
+    Sample sample = seqLock.load();
+    double value = static_cast<double>(sample.counter);
+    if (sample.values[0] != value || sample.values[1] != -value ||
+      sample.values[2] != 2 * value || sample.counter < lastCounter)
+    {
+      ++numberOfInconsistentValues;
+    }
+    lastCounter = sample.counter;
+  }
+  writer.join();
+
+  EXPECT_EQ(numberOfInconsistentValues, 0);
+  EXPECT_EQ(seqLock.load().counter, 200000);
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -13,7 +13,9 @@
 // limitations under the License.
 
 // std
+#include <algorithm>
 #include <string>
+#include <thread>
 #include <vector>
 #include <memory>
 #include <map>
@@ -23,39 +25,47 @@
 
 // romea
 #include "romea_core_rtls/coordination/RTLSSimpleCoordinatorScheduler.hpp"
+#include "romea_core_rtls/coordination/RTLSVirtualClock.hpp"
 
 class TestSimpleCoordinatorScheduler : public ::testing::Test
 {
 protected:
   TestSimpleCoordinatorScheduler()
-  : scheduler_(nullptr),
+  : clock_(std::make_shared<romea::core::RTLSVirtualClock>()),
+    scheduler_(nullptr),
     initiatorsIndexes_(),
-    respondersIndexes_()
+    respondersIndexes_(),
+    timeouts_()
   {
   }
 
   void init(
     const double & pollRate,
     const std::vector<std::string> & initiatorsNames,
-    const std::vector<std::string> & respondersNames)
+    const std::vector<std::string> & respondersNames,
+    const romea::core::RTLSSimpleCoordinatorScheduler::PollingMode & pollingMode =
+    romea::core::RTLSSimpleCoordinatorScheduler::PollingMode::TIMER)
   {
     auto callback = [this](
       const size_t & initiatorIndex,
       const size_t & responderIndex,
-      const romea::core::Duration & /*timeout*/)
+      const romea::core::Duration & timeout)
       {
         initiatorsIndexes_.push_back(initiatorIndex);
         respondersIndexes_.push_back(responderIndex);
+        timeouts_.push_back(timeout);
         return romea::core::RTLSTransceiverRangingResult();
       };
 
     scheduler_ = std::make_unique<romea::core::RTLSSimpleCoordinatorScheduler>(
-      pollRate, initiatorsNames, respondersNames, callback);
+      pollRate, initiatorsNames, respondersNames, callback, pollingMode, clock_);
   }
 
+  std::shared_ptr<romea::core::RTLSVirtualClock> clock_;
   std::unique_ptr<romea::core::RTLSSimpleCoordinatorScheduler> scheduler_;
   std::vector<size_t> initiatorsIndexes_;
   std::vector<size_t> respondersIndexes_;
+  std::vector<romea::core::Duration> timeouts_;
 };
 
 
@@ -64,7 +74,7 @@ TEST_F(TestSimpleCoordinatorScheduler, checkPollWhenOneResponderIsUsed)
   init(20.0, {"initiator0", "initiator1"}, {"responder0"});
 
   scheduler_->start();
-  std::this_thread::sleep_for(romea::core::durationFromSecond(1));
+  clock_->advance(romea::core::durationFromSecond(1));
   scheduler_->stop();
 
   EXPECT_EQ(initiatorsIndexes_[0], 0);
@@ -82,12 +92,35 @@ TEST_F(TestSimpleCoordinatorScheduler, checkPollWhenOneResponderIsUsed)
   EXPECT_STREQ(report.info["responder0"].c_str(), "");
 }
 
+TEST_F(TestSimpleCoordinatorScheduler, checkPollWhenSystemClockIsUsed)
+{
+  auto callback = [this](
+    const size_t & initiatorIndex,
+    const size_t & responderIndex,
+    const romea::core::Duration & /*timeout*/)
+    {
+      initiatorsIndexes_.push_back(initiatorIndex);
+      respondersIndexes_.push_back(responderIndex);
+    };
+
+  scheduler_ = std::make_unique<romea::core::RTLSSimpleCoordinatorScheduler>(
+    20.0, std::vector<std::string>{"initiator0"}, std::vector<std::string>{"responder0"},
+    callback);
+
+  scheduler_->start();
+  std::this_thread::sleep_for(romea::core::durationFromSecond(1));
+  scheduler_->stop();
+
+  EXPECT_GE(respondersIndexes_.size(), 18u);
+  EXPECT_LE(respondersIndexes_.size(), 21u);
+}
+
 TEST_F(TestSimpleCoordinatorScheduler, checkPollWhenTwoRespondersIsUsed)
 {
   init(20.0, {"initiator0", "initiator1"}, {"responder0", "responder1"});
 
   scheduler_->start();
-  std::this_thread::sleep_for(romea::core::durationFromSecond(1));
+  clock_->advance(romea::core::durationFromSecond(1));
   scheduler_->stop();
 
   EXPECT_EQ(initiatorsIndexes_[0], 0);
@@ -110,6 +143,162 @@ TEST_F(TestSimpleCoordinatorScheduler, checkPollWhenTwoRespondersIsUsed)
   EXPECT_STREQ(report.info["responder1"].c_str(), "");
 }
 
+//-----------------------------------------------------------------------------
+TEST_F(TestSimpleCoordinatorScheduler, checkPollWhenSuperframeIsUsed)
+{
+  init(20.0, {"initiator0", "initiator1"}, {"responder0", "responder1"});
+  scheduler_->enableSuperframe();
+
+  const auto & superframe = scheduler_->getSuperframe();
+  ASSERT_EQ(superframe.size(), 4);
+  EXPECT_EQ(superframe[3].initiatorIndex, 1);
+  EXPECT_EQ(superframe[3].responderIndex, 1);
+
+  scheduler_->start();
+  clock_->advance(romea::core::durationFromSecond(1));
+  scheduler_->stop();
+
+  EXPECT_EQ(initiatorsIndexes_[0], 0);
+  EXPECT_EQ(respondersIndexes_[0], 0);
+  EXPECT_EQ(initiatorsIndexes_[1], 0);
+  EXPECT_EQ(respondersIndexes_[1], 1);
+  EXPECT_EQ(initiatorsIndexes_[2], 1);
+  EXPECT_EQ(respondersIndexes_[2], 0);
+  EXPECT_EQ(initiatorsIndexes_[3], 1);
+  EXPECT_EQ(respondersIndexes_[3], 1);
+  EXPECT_EQ(initiatorsIndexes_[4], 0);
+  EXPECT_EQ(respondersIndexes_[4], 0);
+  EXPECT_EQ(initiatorsIndexes_.size(), 20);
+}
+
+TEST_F(TestSimpleCoordinatorScheduler, checkPollWhenCompletionModeIsUsed)
+{
+  init(
+    1.0, {"initiator0"}, {"responder0", "responder1"},
+    romea::core::RTLSSimpleCoordinatorScheduler::PollingMode::COMPLETION);
+
+  romea::core::RTLSTransceiverRangingResult result;
+  result.range = 1.0;
+
+  scheduler_->start();
+  EXPECT_EQ(respondersIndexes_.size(), 1);
+  scheduler_->feedback(0, 0, result);
+  EXPECT_EQ(respondersIndexes_.size(), 2);
+  scheduler_->feedback(0, 0, result);
+  EXPECT_EQ(respondersIndexes_.size(), 2);
+  scheduler_->feedback(0, 1, romea::core::RTLSTransceiverRangingResult());
+  EXPECT_EQ(respondersIndexes_.size(), 3);
+  scheduler_->stop();
+  scheduler_->feedback(0, 0, result);
+  EXPECT_EQ(respondersIndexes_.size(), 3);
+
+  EXPECT_EQ(respondersIndexes_[0], 0);
+  EXPECT_EQ(respondersIndexes_[1], 1);
+  EXPECT_EQ(respondersIndexes_[2], 0);
+}
+
+TEST_F(TestSimpleCoordinatorScheduler, checkTimeoutsWhenAdaptiveTimeoutsAreUsed)
+{
+  init(
+    20.0, {"initiator0"}, {"responder0", "responder1"},
+    romea::core::RTLSSimpleCoordinatorScheduler::PollingMode::COMPLETION);
+  scheduler_->enableAdaptiveTimeouts(0.95, 1.5, romea::core::durationFromMilliSecond(2));
+
+  romea::core::RTLSTransceiverRangingResult result;
+  result.range = 1.0;
+
+  scheduler_->start();
+  for (size_t n = 0; n < 40; ++n) {
+    scheduler_->feedback(initiatorsIndexes_.back(), respondersIndexes_.back(), result);
+  }
+  scheduler_->stop();
+
+  EXPECT_EQ(timeouts_.front(), romea::core::durationFromMilliSecond(49));
+  EXPECT_EQ(timeouts_.back(), romea::core::durationFromMilliSecond(2));
+  EXPECT_EQ(scheduler_->getTimeout(0, 1), romea::core::durationFromMilliSecond(2));
+}
+
+TEST_F(TestSimpleCoordinatorScheduler, checkDeadRespondersAreLeftOutOfRotation)
+{
+  init(
+    20.0, {"initiator0"}, {"responder0", "responder1", "responder2"},
+    romea::core::RTLSSimpleCoordinatorScheduler::PollingMode::COMPLETION);
+  scheduler_->enableHealthAwareRotation(
+    romea::core::durationFromSecond(10), romea::core::durationFromSecond(10));
+
+  romea::core::RTLSTransceiverRangingResult result;
+  result.range = 1.0;
+
+  scheduler_->start();
+  for (size_t n = 0; n < 60; ++n) {
+    size_t responderIndex = respondersIndexes_.back();
+    scheduler_->feedback(
+      initiatorsIndexes_.back(), responderIndex,
+      responderIndex == 1 ? romea::core::RTLSTransceiverRangingResult() : result);
+  }
+  scheduler_->stop();
+
+  EXPECT_FALSE(scheduler_->isResponderHealthy(1));
+  EXPECT_TRUE(scheduler_->isResponderHealthy(0));
+  EXPECT_TRUE(scheduler_->isResponderHealthy(2));
+  EXPECT_EQ(std::count(respondersIndexes_.end() - 30, respondersIndexes_.end(), 1), 0);
+  EXPECT_EQ(std::count(respondersIndexes_.end() - 30, respondersIndexes_.end(), 0), 15);
+}
+
+TEST_F(TestSimpleCoordinatorScheduler, checkBlockedLinksArePruned)
+{
+  init(
+    20.0, {"initiator0", "initiator1"}, {"responder0", "responder1"},
+    romea::core::RTLSSimpleCoordinatorScheduler::PollingMode::COMPLETION);
+  scheduler_->enableLinksPruning(
+    0.3, romea::core::durationFromSecond(10), romea::core::durationFromSecond(10));
+
+  romea::core::RTLSTransceiverRangingResult result;
+  result.range = 1.0;
+
+  // link between initiator1 and responder0 is blocked, other links are fine
+  scheduler_->start();
+  for (size_t n = 0; n < 60; ++n) {
+    size_t initiatorIndex = initiatorsIndexes_.back();
+    size_t responderIndex = respondersIndexes_.back();
+    bool isBlocked = initiatorIndex == 1 && responderIndex == 0;
+    scheduler_->feedback(
+      initiatorIndex, responderIndex,
+      isBlocked ? romea::core::RTLSTransceiverRangingResult() : result);
+  }
+  scheduler_->stop();
+
+  EXPECT_TRUE(scheduler_->isLinkPruned(1, 0));
+  EXPECT_FALSE(scheduler_->isLinkPruned(0, 0));
+  EXPECT_FALSE(scheduler_->isLinkPruned(1, 1));
+  EXPECT_LT(scheduler_->getLinkQuality(1, 0), 0.3);
+  EXPECT_DOUBLE_EQ(scheduler_->getLinkQuality(0, 0), 1.0);
+  EXPECT_TRUE(scheduler_->isResponderHealthy(0));
+
+  size_t numberOfBlockedPolls = 0;
+  size_t numberOfResponder0Polls = 0;
+  for (size_t n = initiatorsIndexes_.size() - 30; n < initiatorsIndexes_.size(); ++n) {
+    numberOfBlockedPolls += initiatorsIndexes_[n] == 1 && respondersIndexes_[n] == 0;
+    numberOfResponder0Polls += respondersIndexes_[n] == 0;
+  }
+  EXPECT_EQ(numberOfBlockedPolls, 0u);
+  EXPECT_EQ(numberOfResponder0Polls, 10u);
+}
+
+TEST_F(TestSimpleCoordinatorScheduler, checkWatchdogWhenCompletionModeIsUsed)
+{
+  init(
+    20.0, {"initiator0"}, {"responder0", "responder1"},
+    romea::core::RTLSSimpleCoordinatorScheduler::PollingMode::COMPLETION);
+
+  scheduler_->start();
+  clock_->advance(romea::core::durationFromSecond(1));
+  scheduler_->stop();
+
+  EXPECT_GE(respondersIndexes_.size(), 5);
+  EXPECT_LE(respondersIndexes_.size(), 21);
+}
+
 
 //-----------------------------------------------------------------------------
 int main(int argc, char ** argv)
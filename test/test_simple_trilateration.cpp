@@ -89,6 +89,138 @@ TEST(TestRobotToHuman, testTrilateration2D3ADown)
 }
 
 
+//-----------------------------------------------------------------------------
+TEST(TestRobotToHuman, testLinearTrilateration2D3A)
+{
+  Eigen::Vector2d tagPosition = Eigen::Vector2d(6, -3);
+
+  romea::core::VectorOfEigenVector2d anchorPositions(3);
+  anchorPositions[0] = Eigen::Vector2d(0, 0.6);
+  anchorPositions[1] = Eigen::Vector2d(0, -0.6);
+  anchorPositions[2] = Eigen::Vector2d(1, 0);
+
+  std::vector<double> ranges(3);
+  ranges[0] = (tagPosition - anchorPositions[0]).norm();
+  ranges[1] = (tagPosition - anchorPositions[1]).norm();
+  ranges[2] = (tagPosition - anchorPositions[2]).norm();
+
+  Eigen::Vector2d tagEstimatedPosition =
+    romea::core::SimpleTrilateration2D::computeByLinearLeastSquares(anchorPositions, ranges);
+
+  EXPECT_NEAR(tagPosition.x(), tagEstimatedPosition.x(), 0.001);
+  EXPECT_NEAR(tagPosition.y(), tagEstimatedPosition.y(), 0.001);
+}
+
+
+//-----------------------------------------------------------------------------
+TEST(TestRobotToHuman, testLinearTrilateration2DWithRangesIndexes)
+{
+  Eigen::Vector2d tagPosition = Eigen::Vector2d(-4, 7);
+
+  romea::core::VectorOfEigenVector2d anchorPositions(5);
+  anchorPositions[0] = Eigen::Vector2d(-10, -10);
+  anchorPositions[1] = Eigen::Vector2d(10, -10);
+  anchorPositions[2] = Eigen::Vector2d(10, 10);
+  anchorPositions[3] = Eigen::Vector2d(-10, 10);
+  anchorPositions[4] = Eigen::Vector2d(0, 0);
+
+  std::vector<double> ranges(5);
+  for (size_t n = 0; n < 5; ++n) {
+    ranges[n] = (tagPosition - anchorPositions[n]).norm();
+  }
+  ranges[1] = 1000;
+
+  Eigen::Vector2d tagEstimatedPosition =
+    romea::core::SimpleTrilateration2D::computeByLinearLeastSquares(
+    anchorPositions, ranges, {0, 2, 3, 4});
+
+  EXPECT_NEAR(tagPosition.x(), tagEstimatedPosition.x(), 0.001);
+  EXPECT_NEAR(tagPosition.y(), tagEstimatedPosition.y(), 0.001);
+}
+
+
+//-----------------------------------------------------------------------------
+TEST(TestRobotToHuman, testLinearTrilateration2DWithCollinearAnchors)
+{
+  Eigen::Vector2d tagPosition(5, 2);
+
+  romea::core::VectorOfEigenVector2d anchorPositions(3);
+  anchorPositions[0] = Eigen::Vector2d(0, 0.3);
+  anchorPositions[1] = Eigen::Vector2d(0, 0);
+  anchorPositions[2] = Eigen::Vector2d(0, -0.3);
+
+  std::vector<double> ranges(3);
+  ranges[0] = (tagPosition - anchorPositions[0]).norm();
+  ranges[1] = (tagPosition - anchorPositions[1]).norm();
+  ranges[2] = (tagPosition - anchorPositions[2]).norm();
+
+  // collinear anchors only give the tag position up to its mirror image across their line
+  Eigen::Vector2d tagEstimatedPosition =
+    romea::core::SimpleTrilateration2D::computeByLinearLeastSquares(anchorPositions, ranges);
+  EXPECT_NEAR(tagPosition.x(), tagEstimatedPosition.x(), 0.001);
+  EXPECT_NEAR(tagPosition.y(), tagEstimatedPosition.y(), 0.001);
+
+  Eigen::Vector2d mirroredTagPosition(-5, 2);
+  ranges[0] = (mirroredTagPosition - anchorPositions[0]).norm();
+  ranges[1] = (mirroredTagPosition - anchorPositions[1]).norm();
+  ranges[2] = (mirroredTagPosition - anchorPositions[2]).norm();
+
+  tagEstimatedPosition =
+    romea::core::SimpleTrilateration2D::computeByLinearLeastSquares(anchorPositions, ranges);
+  EXPECT_NEAR(tagPosition.x(), tagEstimatedPosition.x(), 0.001);
+  EXPECT_NEAR(tagPosition.y(), tagEstimatedPosition.y(), 0.001);
+}
+
+
+//-----------------------------------------------------------------------------
+TEST(TestRobotToHuman, testTrilateration2DWithRangesIndexes)
+{
+  Eigen::Vector2d tagPosition = Eigen::Vector2d(6, -3);
+
+  romea::core::VectorOfEigenVector2d anchorPositions(5);
+  anchorPositions[0] = Eigen::Vector2d(-10, -10);
+  anchorPositions[1] = Eigen::Vector2d(0, 0.6);
+  anchorPositions[2] = Eigen::Vector2d(0, -0.6);
+  anchorPositions[3] = Eigen::Vector2d(10, 10);
+  anchorPositions[4] = Eigen::Vector2d(1, 0);
+
+  std::vector<double> ranges(5, 1000);
+  ranges[1] = (tagPosition - anchorPositions[1]).norm();
+  ranges[2] = (tagPosition - anchorPositions[2]).norm();
+  ranges[4] = (tagPosition - anchorPositions[4]).norm();
+
+  Eigen::Vector2d tagEstimatedPosition =
+    romea::core::SimpleTrilateration2D::compute(anchorPositions, ranges, {1, 2, 4});
+
+  EXPECT_NEAR(tagPosition.x(), tagEstimatedPosition.x(), 0.001);
+  EXPECT_NEAR(tagPosition.y(), tagEstimatedPosition.y(), 0.001);
+}
+
+
+//-----------------------------------------------------------------------------
+TEST(TestRobotToHuman, testTrilateration2DWithTwoRangesIndexes)
+{
+  Eigen::Vector2d tagPosition(5, 2);
+
+  romea::core::VectorOfEigenVector2d anchorPositions(4);
+  anchorPositions[0] = Eigen::Vector2d(-10, -10);
+  anchorPositions[1] = Eigen::Vector2d(0, 0.3);
+  anchorPositions[2] = Eigen::Vector2d(10, 10);
+  anchorPositions[3] = Eigen::Vector2d(0, -0.3);
+
+  std::vector<double> ranges(4, 1000);
+  ranges[1] = (tagPosition - anchorPositions[1]).norm();
+  ranges[3] = (tagPosition - anchorPositions[3]).norm();
+
+  Eigen::Vector2d tagEstimatedPosition =
+    romea::core::SimpleTrilateration2D::computeByLinearLeastSquares(
+    anchorPositions, ranges, {1, 3});
+
+  EXPECT_NEAR(tagPosition.x(), tagEstimatedPosition.x(), 0.001);
+  EXPECT_NEAR(tagPosition.y(), tagEstimatedPosition.y(), 0.001);
+}
+
+
 //-----------------------------------------------------------------------------
 int main(int argc, char ** argv)
 {
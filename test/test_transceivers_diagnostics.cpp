@@ -0,0 +1,136 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <string>
+#include <vector>
+
+// gtest
+#include "gtest/gtest.h"
+
+// romea
+#include "romea_core_rtls/coordination/RTLSTransceiversDiagnostics.hpp"
+
+using romea::core::DiagnosticStatus;
+using romea::core::RTLSTransceiverRangingResult;
+using romea::core::RTLSTransceiverReliability;
+
+namespace
+{
+RTLSTransceiverRangingResult success()
+{
+  RTLSTransceiverRangingResult result;
+  result.range = 10.0;
+  return result;
+}
+
+RTLSTransceiverRangingResult failure()
+{
+  return RTLSTransceiverRangingResult();
+}
+}
+
+class TestTransceiversDiagnostics : public ::testing::Test
+{
+protected:
+  TestTransceiversDiagnostics()
+  : diagnostics_(8.0, {"initiator0", "initiator1"}, {"responder0", "responder1"})
+  {
+  }
+
+  romea::core::RTLSTransceiversDiagnostics diagnostics_;
+};
+
+//-----------------------------------------------------------------------------
+TEST_F(TestTransceiversDiagnostics, checkReportsAreOnlyRenderedWhenStatusOrBucketChanges)
+{
+  auto report = diagnostics_.getReport();
+  EXPECT_EQ(diagnostics_.getNumberOfRenderedReports(), 4);
+  EXPECT_TRUE(report.diagnostics.empty());
+
+  diagnostics_.getReport();
+  EXPECT_EQ(diagnostics_.getNumberOfRenderedReports(), 4);
+
+  // full responder windows of successes keep the same reliability
+  for (size_t n = 0; n < 8; ++n) {
+    diagnostics_.update(0, 0, success(), romea::core::TimePoint());
+  }
+  report = diagnostics_.getReport();
+  EXPECT_EQ(diagnostics_.getNumberOfRenderedReports(), 6);
+  EXPECT_EQ(report.diagnostics.size(), 2);
+  EXPECT_EQ(std::stod(report.info["initiator0"]), 1.0);
+  EXPECT_EQ(std::stod(report.info["responder0"]), 1.0);
+
+  diagnostics_.update(0, 0, success(), romea::core::TimePoint());
+  diagnostics_.getReport();
+  EXPECT_EQ(diagnostics_.getNumberOfRenderedReports(), 6);
+
+  diagnostics_.update(0, 0, failure(), romea::core::TimePoint());
+  report = diagnostics_.getReport();
+  EXPECT_EQ(diagnostics_.getNumberOfRenderedReports(), 8);
+  EXPECT_EQ(report.diagnostics.front().status, DiagnosticStatus::OK);
+  EXPECT_NEAR(std::stod(report.info["responder0"]), 0.875, 1e-6);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(TestTransceiversDiagnostics, checkReportOfSelectedResponders)
+{
+  diagnostics_.update(1, 1, failure(), romea::core::TimePoint());
+
+  auto report = diagnostics_.getReport({1});
+  EXPECT_EQ(report.info.count("responder0"), 0);
+  EXPECT_EQ(report.info.count("responder1"), 1);
+  EXPECT_EQ(report.diagnostics.back().status, DiagnosticStatus::ERROR);
+
+  report = diagnostics_.getReport({0});
+  EXPECT_EQ(report.info.count("responder0"), 0);
+  EXPECT_EQ(report.info.count("responder1"), 0);
+  EXPECT_EQ(report.info.count("initiator1"), 1);
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(TestTransceiversDiagnostics, checkNumericSnapshots)
+{
+  diagnostics_.update(0, 1, success(), romea::core::TimePoint());
+  diagnostics_.update(0, 1, failure(), romea::core::TimePoint());
+
+  std::vector<RTLSTransceiverReliability> initiatorsReliabilities;
+  diagnostics_.getInitiatorsReliabilities(initiatorsReliabilities);
+  ASSERT_EQ(initiatorsReliabilities.size(), 2);
+  EXPECT_DOUBLE_EQ(initiatorsReliabilities[0].reliability, 4 / 6.);
+  EXPECT_EQ(initiatorsReliabilities[0].numberOfSamples, 2);
+  EXPECT_EQ(initiatorsReliabilities[0].status, DiagnosticStatus::WARN);
+  EXPECT_EQ(initiatorsReliabilities[1].status, DiagnosticStatus::STALE);
+
+  std::vector<RTLSTransceiverReliability> respondersReliabilities;
+  diagnostics_.getRespondersReliabilities(respondersReliabilities);
+  ASSERT_EQ(respondersReliabilities.size(), 2);
+  EXPECT_DOUBLE_EQ(respondersReliabilities[1].reliability, 0.5);
+  EXPECT_EQ(respondersReliabilities[1].status, DiagnosticStatus::WARN);
+
+  diagnostics_.addResponder("responder2");
+  diagnostics_.update(0, 2, failure(), romea::core::TimePoint());
+  diagnostics_.getRespondersReliabilities(respondersReliabilities);
+  ASSERT_EQ(respondersReliabilities.size(), 3);
+  EXPECT_DOUBLE_EQ(respondersReliabilities[1].reliability, 0.5);
+  EXPECT_EQ(respondersReliabilities[2].status, DiagnosticStatus::ERROR);
+  EXPECT_EQ(diagnostics_.getReport().info.count("responder2"), 1);
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 // std
+#include <algorithm>
 #include <cmath>
 #include <vector>
 
@@ -138,6 +139,58 @@ TEST(TestSerialization, testTwist2DSerialization)
   EXPECT_NEAR(std::sqrt(twist.covariance(2, 2)), std::sqrt(0.033), 0.1 * M_PI / 180.);
 }
 
+//-----------------------------------------------------------------------------
+TEST(TestSerialization, testTwist2DSerializationIntoArray)
+{
+  romea::core::Twist2D twist;
+  twist.linearSpeeds = Eigen::Vector2d(1.234, -0.567);
+  twist.angularSpeed = 0.321;
+  twist.covariance.diagonal() << 0.04, 0.01, 0.002;
+
+  romea::core::SerializedTwist2D buffer;
+  romea::core::serializeTwist2D(twist, buffer);
+  std::vector<unsigned char> vectorBuffer = romea::core::serializeTwist2D(twist);
+  EXPECT_TRUE(std::equal(buffer.begin(), buffer.end(), vectorBuffer.begin(), vectorBuffer.end()));
+
+  romea::core::Twist2D deserializedTwist = romea::core::deserializeTwist2D(buffer);
+  EXPECT_NEAR(deserializedTwist.linearSpeeds.x(), 1.234, 0.001);
+  EXPECT_NEAR(deserializedTwist.linearSpeeds.y(), -0.567, 0.001);
+  EXPECT_NEAR(deserializedTwist.angularSpeed, 0.321, 0.01 * M_PI / 180.);
+
+  // in place deserialization clears cross covariances of previous twist
+  deserializedTwist.covariance.setConstant(1.0);
+  romea::core::deserializeTwist2D(buffer.data(), deserializedTwist);
+  EXPECT_NEAR(deserializedTwist.covariance(0, 0), 0.04, 0.01);
+  EXPECT_DOUBLE_EQ(deserializedTwist.covariance(0, 2), 0);
+  EXPECT_DOUBLE_EQ(deserializedTwist.covariance(2, 1), 0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestSerialization, testTwist2DBatchSerialization)
+{
+  std::vector<romea::core::Twist2D> twists(5);
+  for (size_t n = 0; n < twists.size(); ++n) {
+    twists[n].linearSpeeds = Eigen::Vector2d(1.5 * n, -0.25 * n);
+    twists[n].angularSpeed = 0.1 * n;
+    twists[n].covariance.diagonal() << 0.01 * n, 0.01 * n, 0.001 * n;
+  }
+
+  std::vector<unsigned char> buffer(twists.size() * romea::core::TWIST2D_SERIALIZED_SIZE);
+  romea::core::serializeTwist2DBatch(twists.data(), twists.size(), buffer.data());
+
+  std::vector<romea::core::Twist2D> deserializedTwists(twists.size());
+  romea::core::deserializeTwist2DBatch(buffer.data(), twists.size(), deserializedTwists.data());
+
+  for (size_t n = 0; n < twists.size(); ++n) {
+    auto first = buffer.begin() + n * romea::core::TWIST2D_SERIALIZED_SIZE;
+    std::vector<unsigned char> twistBuffer = romea::core::serializeTwist2D(twists[n]);
+    EXPECT_TRUE(std::equal(twistBuffer.begin(), twistBuffer.end(), first));
+    EXPECT_NEAR(deserializedTwists[n].linearSpeeds.x(), twists[n].linearSpeeds.x(), 0.001);
+    EXPECT_NEAR(deserializedTwists[n].linearSpeeds.y(), twists[n].linearSpeeds.y(), 0.001);
+    EXPECT_NEAR(deserializedTwists[n].angularSpeed, twists[n].angularSpeed, 0.01 * M_PI / 180.);
+  }
+}
+
 //-----------------------------------------------------------------------------
 int main(int argc, char ** argv)
 {
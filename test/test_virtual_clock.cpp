@@ -0,0 +1,92 @@
+// Copyright 2022 INRAE, French National Research Institute for Agriculture, Food and Environment
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// std
+#include <string>
+#include <vector>
+
+// gtest
+#include "gtest/gtest.h"
+
+// romea
+#include "romea_core_rtls/coordination/RTLSVirtualClock.hpp"
+
+//-----------------------------------------------------------------------------
+TEST(TestVirtualClock, checkTicksAreFiredInChronologicalOrder)
+{
+  romea::core::RTLSVirtualClock clock;
+  std::vector<std::string> ticks;
+  std::vector<romea::core::Duration> stamps;
+
+  auto fastTicker = clock.createTicker(
+    [&]() {
+      ticks.push_back("fast");
+      stamps.push_back(clock.now().time_since_epoch());
+    }, romea::core::durationFromMilliSecond(30));
+  auto slowTicker = clock.createTicker(
+    [&]() {
+      ticks.push_back("slow");
+      stamps.push_back(clock.now().time_since_epoch());
+    }, romea::core::durationFromMilliSecond(50));
+
+  fastTicker->start();
+  slowTicker->start();
+  EXPECT_EQ(clock.getNextTickStamp().time_since_epoch(), romea::core::durationFromMilliSecond(30));
+
+  clock.advance(romea::core::durationFromMilliSecond(100));
+  EXPECT_EQ(ticks, std::vector<std::string>({"fast", "slow", "fast", "fast", "slow"}));
+  EXPECT_EQ(stamps[1], romea::core::durationFromMilliSecond(50));
+  EXPECT_EQ(stamps[3], romea::core::durationFromMilliSecond(90));
+  EXPECT_EQ(clock.now().time_since_epoch(), romea::core::durationFromMilliSecond(100));
+
+  slowTicker->stop();
+  clock.advance(romea::core::durationFromMilliSecond(100));
+  EXPECT_EQ(ticks.size(), 8u);
+
+  fastTicker.reset();
+  clock.advance(romea::core::durationFromMilliSecond(100));
+  EXPECT_EQ(ticks.size(), 8u);
+  EXPECT_EQ(clock.getNextTickStamp(), romea::core::TimePoint::max());
+}
+
+//-----------------------------------------------------------------------------
+TEST(TestVirtualClock, checkTickersCanBeRestartedFromCallbacks)
+{
+  romea::core::RTLSVirtualClock clock(romea::core::TimePoint(romea::core::durationFromSecond(1)));
+  std::unique_ptr<romea::core::RTLSTicker> ticker;
+  size_t numberOfTicks = 0;
+
+  ticker = clock.createTicker(
+    [&]() {
+      if (++numberOfTicks == 2) {
+        ticker->stop();
+      }
+    }, romea::core::durationFromMilliSecond(10));
+  ticker->start();
+
+  clock.advance(romea::core::durationFromMilliSecond(100));
+  EXPECT_EQ(numberOfTicks, 2u);
+
+  ticker->start();
+  clock.advance(romea::core::durationFromMilliSecond(15));
+  EXPECT_EQ(numberOfTicks, 3u);
+  ticker.reset();
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}